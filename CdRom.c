@@ -24,9 +24,14 @@
 #include "cdrom.h"
 #include "ppf.h"
 #include "psxdma.h"
+#include "cdriso.h"
 
 cdrStruct cdr;
 
+// Data of the current sector: cdr.Transfer, or the sector itself when the
+// image is mapped
+static u8 *cdrTransfer = cdr.Transfer;
+
 /* CD-ROM magic numbers */
 #define CdlSync        0
 #define CdlNop         1
@@ -121,6 +126,22 @@ unsigned char Test23[] = { 0x43, 0x58, 0x44, 0x32, 0x39 ,0x34, 0x30, 0x51 };
 // so (PSXCLK / 75) = cdr read time (linuzappz)
 #define cdReadTime (PSXCLK / 75)
 
+// Seeks and data reads under Config.CdSpeed. XA streaming (MODE_STRSND)
+// keeps the drive's pace so the audio plays at the right rate, CDDA goes
+// through cdrPlayInterrupt and isn't affected either.
+static u32 cdDataTime(u32 eCycle) {
+	if (cdr.Mode & MODE_STRSND) return eCycle;
+
+	switch (Config.CdSpeed) {
+		case CD_SPEED_4X: return eCycle / 4;
+		case CD_SPEED_8X: return eCycle / 8;
+		case CD_SPEED_INSTANT: return eCycle < 0x800 ? eCycle : 0x800;
+	}
+	return eCycle;
+}
+
+#define cdSectorTime() cdDataTime((cdr.Mode & MODE_SPEED) ? (cdReadTime / 2) : cdReadTime)
+
 static struct CdrStat stat;
 static struct SubQ *subq;
 
@@ -185,6 +206,7 @@ extern SPUregisterCallback SPU_registerCallback;
    	cdr.Reading = type; \
   	cdr.FirstSector = 1; \
   	cdr.Readed = 0xff; \
+	cdrIsoPrefetch(cdr.SetSector, (cdr.Mode & MODE_SPEED) ? 150 : 75); \
 	AddIrqQueue(READ_ACK, eCycle); \
 }
 
@@ -213,7 +235,7 @@ extern SPUregisterCallback SPU_registerCallback;
 	cdr.ResultReady = 1; \
 }
 
-void adjustTransferIndex()
+static unsigned int transferSize()
 {
 	unsigned int bufSize = MODE_SIZE_2340;
 	
@@ -222,6 +244,12 @@ void adjustTransferIndex()
 		case MODE_SIZE_2328: bufSize = 12 + 2328; break;
 		case MODE_SIZE_2048: bufSize = 12 + 2048; break;
 	}
+	return bufSize;
+}
+
+void adjustTransferIndex()
+{
+	unsigned int bufSize = transferSize();
 	
 	if (cdr.transferIndex >= bufSize)
 		cdr.transferIndex %= bufSize;
@@ -921,6 +949,7 @@ void cdrPlayInterrupt()
 		CDR_readTrack( temp );
 	}
 
+	cdrTransfer = cdr.Transfer;
 	if( CDR_readCDDA ) {
 		CDR_readCDDA( cdr.SetSectorPlay[0], cdr.SetSectorPlay[1], cdr.SetSectorPlay[2], cdr.Transfer );
 
@@ -978,6 +1007,8 @@ void cdrInterrupt() {
 		return;
 	}
 
+	PSXTRACE(PSXTRACE_CDR_IRQ, Irq, cdr.StatP, 0);
+
 	cdr.Irq = 0xff;
 	cdr.Ctrl &= ~0x80;
 
@@ -1186,7 +1217,7 @@ void cdrInterrupt() {
 			InuYasha - Feudal Fairy Tale: slower
 			- Fixes battles
 			*/
-			AddIrqQueue(CdlPause + 0x20, cdReadTime * 3);
+			AddIrqQueue(CdlPause + 0x20, cdDataTime(cdReadTime * 3));
 			cdr.Ctrl |= 0x80;
 			break;
 
@@ -1366,7 +1397,7 @@ void cdrInterrupt() {
 			Rockman X5 = 0.5-4x
 			- fix capcom logo
 			*/
-			AddIrqQueue(CdlSeekL + 0x20, cdReadTime * 4);
+			AddIrqQueue(CdlSeekL + 0x20, cdDataTime(cdReadTime * 4));
 			break;
 
     	case CdlSeekL + 0x20:
@@ -1388,7 +1419,7 @@ void cdrInterrupt() {
         	cdr.Result[0] = cdr.StatP;
 			cdr.StatP |= STATUS_SEEK;
         	cdr.Stat = Acknowledge;
-			AddIrqQueue(CdlSeekP + 0x20, cdReadTime * 1);
+			AddIrqQueue(CdlSeekP + 0x20, cdDataTime(cdReadTime * 1));
 			break;
 
     	case CdlSeekP + 0x20:
@@ -1549,12 +1580,12 @@ void cdrInterrupt() {
 				// - fix cutscene speech (startup)
 
 				// ??? - use more accurate seek time later
-				CDREAD_INT((cdr.Mode & 0x80) ? (cdReadTime / 2) : cdReadTime * 1);
+				CDREAD_INT(cdSectorTime());
 			} else {
 				cdr.StatP |= STATUS_READ;
 				cdr.StatP &= ~STATUS_SEEK;
 
-				CDREAD_INT((cdr.Mode & 0x80) ? (cdReadTime / 2) : cdReadTime * 1);
+				CDREAD_INT(cdSectorTime());
 			}
 
 			SetResultSize(1);
@@ -1614,14 +1645,23 @@ void cdrReadInterrupt() {
 		fprintf(emuLog, "cdrReadInterrupt() Log: err\n");
 #endif
 		memset(cdr.Transfer, 0, DATA_SIZE);
+		cdrTransfer = cdr.Transfer;
 		cdr.Stat = DiskError;
 		cdr.Result[0] |= STATUS_ERROR;
-		CDREAD_INT((cdr.Mode & 0x80) ? (cdReadTime / 2) : cdReadTime);
+		CDREAD_INT(cdSectorTime());
 		return;
 	}
 
-	memcpy(cdr.Transfer, buf, DATA_SIZE);
-	CheckPPFCache(cdr.Transfer, cdr.Prev[0], cdr.Prev[1], cdr.Prev[2]);
+	if (cdrIsoMapped()) {
+		// Read the sector in place, already patched, only the header is
+		// needed in cdr.Transfer
+		memcpy(cdr.Transfer, buf, 12);
+		cdrTransfer = buf;
+	} else {
+		memcpy(cdr.Transfer, buf, DATA_SIZE);
+		CheckPPFCache(cdr.Transfer, cdr.Prev[0], cdr.Prev[1], cdr.Prev[2]);
+		cdrTransfer = cdr.Transfer;
+	}
 
 
 #ifdef CDR_LOG
@@ -1638,7 +1678,7 @@ void cdrReadInterrupt() {
 		if((cdr.Transfer[4 + 2] & 0x4) &&
 			 (cdr.Transfer[4 + 1] == cdr.Channel) &&
 			 (cdr.Transfer[4 + 0] == cdr.File)) {
-			int ret = xa_decode_sector(&cdr.Xa, cdr.Transfer+4, cdr.FirstSector);
+			int ret = xa_decode_sector(&cdr.Xa, cdrTransfer+4, cdr.FirstSector);
 			if(cdr.FirstSector) {
 				setReadAhead(1);	
 			}
@@ -1709,7 +1749,7 @@ void cdrReadInterrupt() {
 		AddIrqQueue(CdlPause, 0x2000);
 	}
 	else {
-		CDREAD_INT((cdr.Mode & MODE_SPEED) ? (cdReadTime / 2) : cdReadTime);
+		CDREAD_INT(cdSectorTime());
 	}
 
 	/*
@@ -2150,7 +2190,7 @@ unsigned char cdrRead2(void) {
 	if (cdr.Readed == 0) {
 		ret = 0;
 	} else {
-		ret = cdr.Transfer[cdr.transferIndex];
+		ret = cdrTransfer[cdr.transferIndex];
 		cdr.transferIndex++;
 		adjustTransferIndex();
 	}
@@ -2253,7 +2293,7 @@ void cdrWrite3(unsigned char rt) {
 
 #if 1
 		if (cdr.Reading && !cdr.ResultReady) {
-      CDREAD_INT((cdr.Mode & MODE_SPEED) ? (cdReadTime / 2) : cdReadTime);
+      CDREAD_INT(cdSectorTime());
 		}
 #else
 		// XA streaming - incorrect timing because of this reschedule
@@ -2407,11 +2447,18 @@ void psxDma3(u32 madr, u32 bcr, u32 chcr) {
 			}
 #endif
 #endif
-			{
+			if (cdr.transferIndex + cdsize <= transferSize()) {
+				// no wrap, one copy from the sector into RAM
+				memcpy(ptr, cdrTransfer + cdr.transferIndex, cdsize);
+				cdr.transferIndex += cdsize;
+				adjustTransferIndex();
+
+				psxCpu->Clear(madr, cdsize / 4);
+			} else {
 				int i;
 				
 				for(i = 0; i < cdsize; ++i) {
-					ptr[i] = cdr.Transfer[cdr.transferIndex];
+					ptr[i] = cdrTransfer[cdr.transferIndex];
 					cdr.transferIndex++;
 					adjustTransferIndex();
 				}
@@ -2452,6 +2499,7 @@ void cdrDmaInterrupt()
 
 void cdrReset() {
 	memset(&cdr, 0, sizeof(cdr));
+	cdrTransfer = cdr.Transfer;
 	cdr.CurTrack = 1;
 	cdr.File = 1;
 	cdr.Channel = 1;
@@ -2465,7 +2513,16 @@ void cdrReset() {
 #endif
 }
 
-int cdrFreeze(gzFile f, int Mode) {
+// Copies a sector that is being read in place into cdr.Transfer, for when
+// the mapping it lives in goes away (disc swap, plugin close)
+void cdrDetachTransfer() {
+	if (cdrTransfer != cdr.Transfer) {
+		memcpy(cdr.Transfer + 12, cdrTransfer + 12, DATA_SIZE - 12);
+		cdrTransfer = cdr.Transfer;
+	}
+}
+
+int cdrFreeze(FreezeBuf *f, int Mode) {
 	unsigned int tmp;
 
 
@@ -2473,6 +2530,11 @@ int cdrFreeze(gzFile f, int Mode) {
 		StopCdda();
 	}
 	
+	// A sector read in place is saved as if it had been copied
+	if (Mode == 1)
+		cdrDetachTransfer();
+	if (Mode != 2)
+		cdrTransfer = cdr.Transfer;
 	
 	gzfreeze(&cdr, sizeof(cdr));
 
@@ -101,6 +101,7 @@ extern cdrStruct cdr;
 void cdrDecodedBufferInterrupt();
 
 void cdrReset();
+void cdrDetachTransfer();
 void cdrInterrupt();
 void cdrReadInterrupt();
 void cdrLidSeekInterrupt();
@@ -113,7 +114,7 @@ void cdrWrite0(unsigned char rt);
 void cdrWrite1(unsigned char rt);
 void cdrWrite2(unsigned char rt);
 void cdrWrite3(unsigned char rt);
-int cdrFreeze(gzFile f, int Mode);
+int cdrFreeze(FreezeBuf *f, int Mode);
 
 #ifdef __cplusplus
 }
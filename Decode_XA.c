@@ -89,7 +89,7 @@ static __inline void ADPCM_DecodeBlock16( ADPCM_Decode_t *decp, u8 filter_range,
 	const u16 *blockp;
 
 	blockp = (const unsigned short *)vblockp;
-	filterid = (filter_range >>  4) & 0x0f;
+	filterid = (filter_range >>  4) & 0x03;
 	range    = (filter_range >>  0) & 0x0f;
 
 	fy0 = decp->y0;
@@ -121,6 +121,117 @@ static __inline void ADPCM_DecodeBlock16( ADPCM_Decode_t *decp, u8 filter_range,
 
 static int headtable[4] = {0,2,8,10};
 
+//===========================================
+// 4-bit sound units are stored as the low or high nibble of every 4th byte
+// of the sound group data, so they are decoded straight from the sector
+// without first being repacked into 16-bit words.
+#define XA_SATURATE(_X_)		{if((u32)((_X_)+32768)>65535)(_X_)=((_X_)>>31)^32767;}
+
+static __inline void ADPCM_DecodeUnit4( ADPCM_Decode_t *decp, u8 filter_range, const u8 *blockp, int shift, short *destp, int inc ) {
+	int i;
+	int range;
+	s32 ik0, ik1;
+	s32 fy0, fy1;
+
+	range = filter_range & 0x0f;
+	ik0   = IK0((filter_range >> 4) & 0x03);
+	ik1   = IK1((filter_range >> 4) & 0x03);
+
+	fy0 = decp->y0;
+	fy1 = decp->y1;
+
+	for (i = BLKSIZ; i; --i) {
+		s32 x, y;
+
+		x = (short)((*blockp << shift) & 0xf000) >> range; x <<= SH;
+		x -= (ik0 * fy0 + ik1 * fy1) >> SHC; fy1 = fy0; fy0 = x;
+		blockp += 4;
+
+		y = x >> SH;
+		XA_SATURATE( y );
+		*destp = y; destp += inc;
+	}
+	decp->y0 = fy0;
+	decp->y1 = fy1;
+}
+
+//===========================================
+// Left and right units of a stereo pair share their source bytes but not
+// their filter history, so both recurrences run side by side in one loop.
+static __inline void ADPCM_DecodeUnit4Stereo( ADPCM_Decode_t *decl, ADPCM_Decode_t *decr, u8 filter_l, u8 filter_r, const u8 *blockp, short *destp ) {
+	int i;
+	int range_l, range_r;
+	s32 ik0_l, ik1_l, ik0_r, ik1_r;
+	s32 fy0_l, fy1_l, fy0_r, fy1_r;
+
+	range_l = filter_l & 0x0f;
+	range_r = filter_r & 0x0f;
+	ik0_l   = IK0((filter_l >> 4) & 0x03);
+	ik1_l   = IK1((filter_l >> 4) & 0x03);
+	ik0_r   = IK0((filter_r >> 4) & 0x03);
+	ik1_r   = IK1((filter_r >> 4) & 0x03);
+
+	fy0_l = decl->y0; fy1_l = decl->y1;
+	fy0_r = decr->y0; fy1_r = decr->y1;
+
+	for (i = BLKSIZ; i; --i) {
+		s32 xl, xr, yl, yr;
+		u32 b = *blockp;
+
+		xl = (short)((b << 12) & 0xf000) >> range_l; xl <<= SH;
+		xr = (short)((b <<  8) & 0xf000) >> range_r; xr <<= SH;
+		xl -= (ik0_l * fy0_l + ik1_l * fy1_l) >> SHC; fy1_l = fy0_l; fy0_l = xl;
+		xr -= (ik0_r * fy0_r + ik1_r * fy1_r) >> SHC; fy1_r = fy0_r; fy0_r = xr;
+		blockp += 4;
+
+		yl = xl >> SH;
+		yr = xr >> SH;
+		XA_SATURATE( yl );
+		XA_SATURATE( yr );
+		destp[0] = yl;
+		destp[1] = yr;
+		destp += 2;
+	}
+	decl->y0 = fy0_l; decl->y1 = fy1_l;
+	decr->y0 = fy0_r; decr->y1 = fy1_r;
+}
+
+//===========================================
+// Level B/C: every sound group carries 8 units, two per byte lane.
+static void xa_decode_groups4( xa_decode_t *xdp, const u8 *srcp ) {
+	const u8	*sound_groupsp, *sound_datap;
+	int			i, j, nbits;
+	short		*destp;
+
+	destp = xdp->pcm;
+	nbits = xdp->nbits == 4 ? 4 : 2;
+
+	if (xdp->stereo) {
+		for (j=0; j < 18; j++) {
+			sound_groupsp = srcp + j * 128;		// sound groups header
+			sound_datap = sound_groupsp + 16;	// sound data just after the header
+
+			for (i=0; i < nbits; i++) {
+				ADPCM_DecodeUnit4Stereo( &xdp->left, &xdp->right, sound_groupsp[headtable[i]+0],
+										 sound_groupsp[headtable[i]+1], sound_datap + i, destp );
+				destp += 28*2;
+			}
+		}
+	} else {
+		for (j=0; j < 18; j++) {
+			sound_groupsp = srcp + j * 128;		// sound groups header
+			sound_datap = sound_groupsp + 16;	// sound data just after the header
+
+			for (i=0; i < nbits; i++) {
+				ADPCM_DecodeUnit4( &xdp->left, sound_groupsp[headtable[i]+0], sound_datap + i, 12, destp, 1 );
+				destp += 28;
+				ADPCM_DecodeUnit4( &xdp->left, sound_groupsp[headtable[i]+1], sound_datap + i,  8, destp, 1 );
+				destp += 28;
+			}
+		}
+	}
+}
+
 //===========================================
 static void xa_decode_data( xa_decode_t *xdp, unsigned char *srcp ) {
 	const u8    *sound_groupsp;
@@ -129,135 +240,71 @@ static void xa_decode_data( xa_decode_t *xdp, unsigned char *srcp ) {
 	u16			data[4096], *datap;
 	short		*destp;
 
+	if ((xdp->nbits != 8) || (xdp->freq != 37800)) { // level B/C
+		xa_decode_groups4( xdp, srcp );
+		return;
+	}
+
 	destp = xdp->pcm;
 	nbits = xdp->nbits == 4 ? 4 : 2;
 
-	if (xdp->stereo) { // stereo
-		if ((xdp->nbits == 8) && (xdp->freq == 37800)) { // level A
-			for (j=0; j < 18; j++) {
-				sound_groupsp = srcp + j * 128;		// sound groups header
-				sound_datap = sound_groupsp + 16;	// sound data just after the header
-
-				for (i=0; i < nbits; i++) {
-    				datap = data;
-    				sound_datap2 = sound_datap + i;
-
-					for (k=0; k < 14; k++, sound_datap2 += 8) {
-        	   				*(datap++) = (u16)sound_datap2[0] |
-        	               			     (u16)(sound_datap2[4] << 8);
-					}
-
-    				ADPCM_DecodeBlock16( &xdp->left,  sound_groupsp[headtable[i]+0], data,
-        	           				    destp+0, 2 );
-
-        			datap = data;
-        			sound_datap2 = sound_datap + i;
-        			for (k=0; k < 14; k++, sound_datap2 += 8) {
-           					*(datap++) = (u16)sound_datap2[0] |
-            	          			     (u16)(sound_datap2[4] << 8);
-					}
-					ADPCM_DecodeBlock16( &xdp->right,  sound_groupsp[headtable[i]+1], data,
-                           			    destp+1, 2 );
-
-	        		destp += 28*2;
+	if (xdp->stereo) { // stereo, level A
+		for (j=0; j < 18; j++) {
+			sound_groupsp = srcp + j * 128;		// sound groups header
+			sound_datap = sound_groupsp + 16;	// sound data just after the header
+
+			for (i=0; i < nbits; i++) {
+				datap = data;
+				sound_datap2 = sound_datap + i;
+
+				for (k=0; k < 14; k++, sound_datap2 += 8) {
+						*(datap++) = (u16)sound_datap2[0] |
+									 (u16)(sound_datap2[4] << 8);
 				}
-    		}
-		} else { // level B/C
-			for (j=0; j < 18; j++) {
-				sound_groupsp = srcp + j * 128;		// sound groups header
-				sound_datap = sound_groupsp + 16;	// sound data just after the header
-
-				for (i=0; i < nbits; i++) {
-	    			datap = data;
-	    			sound_datap2 = sound_datap + i;
-
-        			for (k=0; k < 7; k++, sound_datap2 += 16) {
-           					*(datap++) = (u16)(sound_datap2[ 0] & 0x0f) |
-                       				    ((u16)(sound_datap2[ 4] & 0x0f) <<  4) |
-                       				    ((u16)(sound_datap2[ 8] & 0x0f) <<  8) |
-                       				    ((u16)(sound_datap2[12] & 0x0f) << 12);
-					}
-	    			ADPCM_DecodeBlock16( &xdp->left,  sound_groupsp[headtable[i]+0], data,
-                   				    destp+0, 2 );
-
-	        		datap = data;
-	        		sound_datap2 = sound_datap + i;
-        			for (k=0; k < 7; k++, sound_datap2 += 16) {
-           					*(datap++) = (u16)(sound_datap2[ 0] >> 4) |
-                       	    			((u16)(sound_datap2[ 4] >> 4) <<  4) |
-                       				    ((u16)(sound_datap2[ 8] >> 4) <<  8) |
-                       				    ((u16)(sound_datap2[12] >> 4) << 12);
-					}
-					ADPCM_DecodeBlock16( &xdp->right,  sound_groupsp[headtable[i]+1], data,
-                           			    destp+1, 2 );
-
-	        		destp += 28*2;
+
+				ADPCM_DecodeBlock16( &xdp->left,  sound_groupsp[headtable[i]+0], data,
+									destp+0, 2 );
+
+				datap = data;
+				sound_datap2 = sound_datap + i;
+				for (k=0; k < 14; k++, sound_datap2 += 8) {
+						*(datap++) = (u16)sound_datap2[0] |
+									 (u16)(sound_datap2[4] << 8);
 				}
-	    	}
+				ADPCM_DecodeBlock16( &xdp->right,  sound_groupsp[headtable[i]+1], data,
+									destp+1, 2 );
+
+				destp += 28*2;
+			}
 		}
-	} else { // mono
-		if ((xdp->nbits == 8) && (xdp->freq == 37800)) { // level A
-			for (j=0; j < 18; j++) {
-    			sound_groupsp = srcp + j * 128;		// sound groups header
-    			sound_datap = sound_groupsp + 16;	// sound data just after the header
-
-    			for (i=0; i < nbits; i++) {
-        			datap = data;
-        			sound_datap2 = sound_datap + i;
-        			for (k=0; k < 14; k++, sound_datap2 += 8) {
-           					*(datap++) = (u16)sound_datap2[0] |
-                       				     (u16)(sound_datap2[4] << 8);
-					}
-	        		ADPCM_DecodeBlock16( &xdp->left,  sound_groupsp[headtable[i]+0], data,
-                           			    destp, 1 );
-
-	        		destp += 28;
-
-	        		datap = data;
-	        		sound_datap2 = sound_datap + i;
-        			for (k=0; k < 14; k++, sound_datap2 += 8) {
-           					*(datap++) = (u16)sound_datap2[0] |
-                       				     (u16)(sound_datap2[4] << 8);
-					}
-	       			ADPCM_DecodeBlock16( &xdp->left,  sound_groupsp[headtable[i]+1], data,
-                           			    destp, 1 );
-
-					destp += 28;
+	} else { // mono, level A
+		for (j=0; j < 18; j++) {
+			sound_groupsp = srcp + j * 128;		// sound groups header
+			sound_datap = sound_groupsp + 16;	// sound data just after the header
+
+			for (i=0; i < nbits; i++) {
+				datap = data;
+				sound_datap2 = sound_datap + i;
+				for (k=0; k < 14; k++, sound_datap2 += 8) {
+						*(datap++) = (u16)sound_datap2[0] |
+									 (u16)(sound_datap2[4] << 8);
 				}
-	    	}
-		} else { // level B/C
-			for (j=0; j < 18; j++) {
-	    		sound_groupsp = srcp + j * 128;		// sound groups header
-	    		sound_datap = sound_groupsp + 16;	// sound data just after the header
-
-	    		for (i=0; i < nbits; i++) {
-	        		datap = data;
-	        		sound_datap2 = sound_datap + i;
-        			for (k=0; k < 7; k++, sound_datap2 += 16) {
-           					*(datap++) = (u16)(sound_datap2[ 0] & 0x0f) |
-                       				    ((u16)(sound_datap2[ 4] & 0x0f) <<  4) |
-                       				    ((u16)(sound_datap2[ 8] & 0x0f) <<  8) |
-                       				    ((u16)(sound_datap2[12] & 0x0f) << 12);
-					}
-	        		ADPCM_DecodeBlock16( &xdp->left,  sound_groupsp[headtable[i]+0], data,
-                           			    destp, 1 );
-
-	        		destp += 28;
-
-	        		datap = data;
-	        		sound_datap2 = sound_datap + i;
-        			for (k=0; k < 7; k++, sound_datap2 += 16) {
-            				*(datap++) = (u16)(sound_datap2[ 0] >> 4) |
-                       	    		    ((u16)(sound_datap2[ 4] >> 4) <<  4) |
-                        				((u16)(sound_datap2[ 8] >> 4) <<  8) |
-                        				((u16)(sound_datap2[12] >> 4) << 12);
-        			}
-	       			ADPCM_DecodeBlock16( &xdp->left,  sound_groupsp[headtable[i]+1], data,
-                           			    destp, 1 );
-
-					destp += 28;
+				ADPCM_DecodeBlock16( &xdp->left,  sound_groupsp[headtable[i]+0], data,
+									destp, 1 );
+
+				destp += 28;
+
+				datap = data;
+				sound_datap2 = sound_datap + i;
+				for (k=0; k < 14; k++, sound_datap2 += 8) {
+						*(datap++) = (u16)sound_datap2[0] |
+									 (u16)(sound_datap2[4] << 8);
 				}
-    		}
+				ADPCM_DecodeBlock16( &xdp->left,  sound_groupsp[headtable[i]+1], data,
+									destp, 1 );
+
+				destp += 28;
+			}
 		}
 	}
 }
@@ -296,9 +343,8 @@ u8  coding2;
 #define SUB_AUDIO   2
 
 //============================================
-static int parse_xa_audio_sector( xa_decode_t *xdp, 
+static int parse_xa_audio_header( xa_decode_t *xdp,
 								  xa_subheader_t *subheadp,
-								  unsigned char *sectorp,
 								  int is_first_sector ) {
     if ( is_first_sector ) {
 		switch ( AUDIO_CODING_GET_FREQ(subheadp->coding) ) {
@@ -326,6 +372,18 @@ static int parse_xa_audio_sector( xa_decode_t *xdp,
 		xdp->nsamples = 18 * 28 * 8;
 		if (xdp->stereo == 1) xdp->nsamples /= 2;
     }
+
+	return 0;
+}
+
+//============================================
+static int parse_xa_audio_sector( xa_decode_t *xdp,
+								  xa_subheader_t *subheadp,
+								  unsigned char *sectorp,
+								  int is_first_sector ) {
+	if (parse_xa_audio_header(xdp, subheadp, is_first_sector))
+		return -1;
+
 	xa_decode_data( xdp, sectorp );
 
 	return 0;
@@ -55,15 +55,33 @@
 
 #ifdef PROFILE
 
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 void start_section(int section_type);
 void end_section(int section_type);
+void profile_zone_end(int *section_type);
 void refresh_stat();
+void profile_print(FILE *f);
+int profile_dump_trace(const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+// Profiles the rest of the enclosing block, however it is left
+#define PROFILE_ZONE(a) \
+	int profile_zone_##a __attribute__((cleanup(profile_zone_end))) = (start_section(a), a)
 
 #else
 
 #define start_section(a)
 #define end_section(a)
 #define refresh_stat()
+#define PROFILE_ZONE(a)
 
 #endif
 
@@ -33,6 +33,9 @@
 # include <debug.h>
 #endif
 #include "../PsxCommon.h"
+#include "../PsxProf.h"
+#include "../PsxTrace.h"
+#include "../SpuTrace.h"
 #include "wiiSXconfig.h"
 #include "menu/MenuContext.h"
 extern "C" {
@@ -88,6 +91,9 @@ FILE *emuLog;
 
 PcsxConfig Config;
 char dynacore;
+char cpuClock;
+char cdSpeed;
+char spuCapture;
 char biosDevice;
 char LoadCdBios=0;
 char frameLimit;
@@ -142,6 +148,7 @@ static struct {
   { "VideoMode", &videoMode, VIDEOMODE_AUTO, VIDEOMODE_PROGRESSIVE },
   { "FileSortMode", &fileSortMode, FILESORT_DIRS_MIXED, FILESORT_DIRS_FIRST },
   { "Core", &dynacore, DYNACORE_DYNAREC, DYNACORE_INTERPRETER },
+  { "CdSpeed", &cdSpeed, CDSPEED_NORMAL, CDSPEED_INSTANT },
   { "NativeDevice", &nativeSaveDevice, NATIVESAVEDEVICE_SD, NATIVESAVEDEVICE_CARDB },
   { "StatesDevice", &saveStateDevice, SAVESTATEDEVICE_SD, SAVESTATEDEVICE_USB },
   { "AutoSave", &autoSave, AUTOSAVE_DISABLE, AUTOSAVE_ENABLE },
@@ -157,6 +164,7 @@ static struct {
   { "RumbleEnabled", &rumbleEnabled, RUMBLE_DISABLE, RUMBLE_ENABLE },
   { "LoadButtonSlot", &loadButtonSlot, LOADBUTTON_SLOT0, LOADBUTTON_DEFAULT },
   { "ControllerType", &controllerType, CONTROLLERTYPE_STANDARD, CONTROLLERTYPE_ANALOG },
+  { "SpuCapture", &spuCapture, SPUCAPTURE_DISABLE, SPUCAPTURE_ENABLE },
 //  { "NumberMultitaps", &numMultitaps, MULTITAPS_NONE, MULTITAPS_TWO },
   { "smbusername", smbUserName, CONFIG_STRING_TYPE, CONFIG_STRING_TYPE },
   { "smbpassword", smbPassWord, CONFIG_STRING_TYPE, CONFIG_STRING_TYPE },
@@ -166,6 +174,7 @@ static struct {
 void handleConfigPair(char* kv);
 void readConfig(FILE* f);
 void writeConfig(FILE* f);
+void loadGameSettings();
 int checkBiosExists(int testDevice);
 
 void loadSettings(int argc, char *argv[])
@@ -189,6 +198,9 @@ void loadSettings(int argc, char *argv[])
 	autoSave         = 1; // Auto Save Game
 	creditsScrolling = 0; // Normal menu for now
 	dynacore         = 0; // Dynarec
+	cpuClock         = CPUCLOCK_1X;
+	cdSpeed          = CDSPEED_NORMAL;
+	spuCapture       = SPUCAPTURE_DISABLE;
 	screenMode		 = 0; // Stretch FB horizontally
 	videoMode		 = VIDEOMODE_AUTO;
 	fileSortMode	 = FILESORT_DIRS_FIRST;
@@ -443,6 +455,7 @@ int loadISO(fileBrowser_file* file)
 		CheckCdrom();
 		LoadCdrom();
 	}
+	loadGameSettings();
 	
 	if(autoSave==AUTOSAVE_ENABLE) {
 		switch (nativeSaveDevice)
@@ -545,6 +558,60 @@ void writeConfig(FILE* f){
 	}
 }
 
+// Per game settings live next to the save states, as saves/<CD-ROM ID>.cfg
+static void gameSettingsPath(char* path){
+#ifdef HW_RVL
+	sprintf(path, "%s/wiisx/saves/%s.cfg",
+	        (saveStateDevice==SAVESTATEDEVICE_USB)?"usb:":"sd:", CdromId);
+#else
+	sprintf(path, "sd:/wiisx/saves/%s.cfg", CdromId);
+#endif
+}
+
+void loadGameSettings(){
+	char path[64];
+	char line[256];
+	int value;
+
+	cpuClock = CPUCLOCK_1X;
+	Config.CdSpeed = cdSpeed;
+	if(CdromId[0]) {
+		gameSettingsPath(path);
+		FILE* f = fopen(path, "r");
+		if(f) {
+			while(fgets(line, 256, f)){
+				if(sscanf(line, "CpuClock = %d", &value) == 1 &&
+				   value >= CPUCLOCK_1X && value <= CPUCLOCK_3X)
+					cpuClock = value;
+				// Games that need real drive timing
+				if(sscanf(line, "CdSpeed = %d", &value) == 1 &&
+				   value >= CDSPEED_NORMAL && value <= CDSPEED_INSTANT)
+					Config.CdSpeed = value;
+			}
+			fclose(f);
+		}
+	}
+
+	Config.CpuClock = cpuClock;
+	psxSetCpuClock();
+}
+
+int saveGameSettings(){
+	char path[64];
+
+	if(!CdromId[0])
+		return 0;
+	gameSettingsPath(path);
+	FILE* f = fopen(path, "wb");
+	if(!f)
+		return 0;
+	fprintf(f, "CpuClock = %d\n", cpuClock);
+	if(Config.CdSpeed != cdSpeed)
+		fprintf(f, "CdSpeed = %d\n", Config.CdSpeed);
+	fclose(f);
+	return 1;
+}
+
 extern "C" {
 //System Functions
 void go(void) {
@@ -563,6 +630,9 @@ int SysInit() {
 	LoadPlugins();
 	if(OpenPlugins() < 0)
 		return -1;
+	//Capture from the first instruction on, see SpuTrace.c
+	if(spuCapture == SPUCAPTURE_ENABLE)
+		SpuTraceStart("sd:/wiisx/spu.trace");
   
 	//Init biosFile pointers and stuff
 	if(biosDevice != BIOSDEVICE_HLE) {
@@ -588,6 +658,10 @@ int SysInit() {
 
 void SysReset() {
 	psxReset();
+#ifdef PROFILE
+	PsxProfStart(256);
+	PsxTraceStart();
+#endif
 }
 
 void SysStartCPU() {
@@ -598,9 +672,19 @@ void SysStartCPU() {
 
 void SysClose() 
 {
+	SpuTraceStop();
 	psxShutdown();
 	ClosePlugins();
 	ReleasePlugins();
+#ifdef PROFILE
+	profile_dump_trace("sd:/wiisx/profile.json");
+	FILE* f = fopen("sd:/wiisx/hotspots.txt", "w");
+	if(f) {
+		PsxProfDump(f, 32);
+		fclose(f);
+	}
+	PsxTraceSave("sd:/wiisx/events.bin");
+#endif
 #if defined (CPU_LOG) || defined(DMA_LOG) || defined(CDR_LOG) || defined(HW_LOG) || \
 	defined(BIOS_LOG) || defined(GTE_LOG) || defined(PAD_LOG)
 	if (emuLog != NULL) fclose(emuLog);
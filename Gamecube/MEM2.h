@@ -9,10 +9,18 @@
 #define KB (1024)
 #define MB (1024*1024)
 
+#ifdef HW_RVL
 // MEM2 begins at MEM2_LO, the Starlet's Dedicated Memory begins at MEM2_HI
 #define MEM2_LO   ((char*)0x90080000)
 #define MEM2_HI   ((char*)0x933E0000)
 #define MEM2_SIZE (MEM2_HI - MEM2_LO)
+#else
+// Host builds lay the same chunks out in an ordinary array (no TEXCACHE)
+#define MEM2_SIZE (8*MB)
+extern char MEM2_host[MEM2_SIZE];
+#define MEM2_LO   (MEM2_host)
+#define MEM2_HI   (MEM2_LO + MEM2_SIZE)
+#endif
 
 // We want 128KB for our MEMCARD 1
 #define MCD1_SIZE     (128*KB)
@@ -50,9 +50,11 @@ void Func_SaveGame();
 void Func_LoadState();
 void Func_SaveState();
 void Func_StateCycle();
+void Func_CpuClock();
+void Func_CdSpeed();
 void Func_ReturnFromCurrentRomFrame();
 
-#define NUM_FRAME_BUTTONS 8
+#define NUM_FRAME_BUTTONS 10
 #define FRAME_BUTTONS currentRomFrameButtons
 #define FRAME_STRINGS currentRomFrameStrings
 
@@ -62,9 +64,10 @@ void Func_ReturnFromCurrentRomFrame();
  * [Show ISO Info]
  * [Load State] [Slot "x"]
  * [Save State]
+ * [CPU Clock] [CD Speed]
  */
 
-static char FRAME_STRINGS[8][15] =
+static char FRAME_STRINGS[10][20] =
 	{ "Restart Game",
 	  "Swap CD",
 	  "Load MemCards",
@@ -72,7 +75,9 @@ static char FRAME_STRINGS[8][15] =
 	  "Show ISO Info",
 	  "Load State",
 	  "Save State",
-	  "Slot 0"};
+	  "Slot 0",
+	  "CPU Clock: 1x",
+	  "CD Speed: Normal"};
 
 struct ButtonInfo
 {
@@ -91,14 +96,16 @@ struct ButtonInfo
 	ButtonFunc		returnFunc;
 } FRAME_BUTTONS[NUM_FRAME_BUTTONS] =
 { //	button	buttonStyle	buttonString		x		y		width	height	Up	Dwn	Lft	Rt	clickFunc			returnFunc
-	{	NULL,	BTN_A_NRM,	FRAME_STRINGS[0],	100.0,	 60.0,	210.0,	56.0,	 6,	 2,	 1,	 1,	Func_ResetROM,		Func_ReturnFromCurrentRomFrame }, // Reset ROM
-	{	NULL,	BTN_A_NRM,	FRAME_STRINGS[1],	330.0,	 60.0,	210.0,	56.0,	 7,	 3,	 0,	 0,	Func_SwapCD,		Func_ReturnFromCurrentRomFrame }, // Swap CD
+	{	NULL,	BTN_A_NRM,	FRAME_STRINGS[0],	100.0,	 60.0,	210.0,	56.0,	 8,	 2,	 1,	 1,	Func_ResetROM,		Func_ReturnFromCurrentRomFrame }, // Reset ROM
+	{	NULL,	BTN_A_NRM,	FRAME_STRINGS[1],	330.0,	 60.0,	210.0,	56.0,	 9,	 3,	 0,	 0,	Func_SwapCD,		Func_ReturnFromCurrentRomFrame }, // Swap CD
 	{	NULL,	BTN_A_NRM,	FRAME_STRINGS[2],	100.0,	120.0,	210.0,	56.0,	 0,	 4,	 3,	 3,	Func_LoadSave,		Func_ReturnFromCurrentRomFrame }, // Load MemCards
 	{	NULL,	BTN_A_NRM,	FRAME_STRINGS[3],	330.0,	120.0,	210.0,	56.0,	 1,	 4,	 2,	 2,	Func_SaveGame,		Func_ReturnFromCurrentRomFrame }, // Save MemCards
 	{	NULL,	BTN_A_NRM,	FRAME_STRINGS[4],	150.0,	180.0,	340.0,	56.0,	 2,	 5,	-1,	-1,	Func_ShowRomInfo,	Func_ReturnFromCurrentRomFrame }, // Show ISO Info
 	{	NULL,	BTN_A_NRM,	FRAME_STRINGS[5],	150.0,	240.0,	220.0,	56.0,	 4,	 6,	 7,	 7,	Func_LoadState,		Func_ReturnFromCurrentRomFrame }, // Load State 
-	{	NULL,	BTN_A_NRM,	FRAME_STRINGS[6],	150.0,	300.0,	220.0,	56.0,	 5,	 0,	 7,	 7,	Func_SaveState,		Func_ReturnFromCurrentRomFrame }, // Save State 
-	{	NULL,	BTN_A_NRM,	FRAME_STRINGS[7],	390.0,	270.0,	100.0,	56.0,	 4,	 1,	 5,	 5,	Func_StateCycle,	Func_ReturnFromCurrentRomFrame }, // Cycle State 
+	{	NULL,	BTN_A_NRM,	FRAME_STRINGS[6],	150.0,	300.0,	220.0,	56.0,	 5,	 8,	 7,	 7,	Func_SaveState,		Func_ReturnFromCurrentRomFrame }, // Save State 
+	{	NULL,	BTN_A_NRM,	FRAME_STRINGS[7],	390.0,	270.0,	100.0,	56.0,	 4,	 9,	 5,	 5,	Func_StateCycle,	Func_ReturnFromCurrentRomFrame }, // Cycle State 
+	{	NULL,	BTN_A_NRM,	FRAME_STRINGS[8],	100.0,	360.0,	210.0,	56.0,	 6,	 0,	 9,	 9,	Func_CpuClock,		Func_ReturnFromCurrentRomFrame }, // CPU Clock
+	{	NULL,	BTN_A_NRM,	FRAME_STRINGS[9],	330.0,	360.0,	210.0,	56.0,	 7,	 1,	 8,	 8,	Func_CdSpeed,		Func_ReturnFromCurrentRomFrame }, // CD Speed
 };
 
 CurrentRomFrame::CurrentRomFrame()
@@ -128,6 +135,15 @@ CurrentRomFrame::CurrentRomFrame()
 
 }
 
+static const char* cpuClockStrings[] = { "CPU Clock: 1x", "CPU Clock: 1.5x", "CPU Clock: 2x", "CPU Clock: 3x" };
+static const char* cdSpeedStrings[] = { "CD Speed: Normal", "CD Speed: 4x", "CD Speed: 8x", "CD Speed: Instant" };
+
+void CurrentRomFrame::activateSubmenu(int submenu)
+{
+	strcpy(FRAME_STRINGS[8], cpuClockStrings[(int)cpuClock]);
+	strcpy(FRAME_STRINGS[9], cdSpeedStrings[Config.CdSpeed]);
+}
+
 CurrentRomFrame::~CurrentRomFrame()
 {
 	for (int i = 0; i < NUM_FRAME_BUTTONS; i++)
@@ -322,16 +338,19 @@ void Func_SaveGame()
 
 void Func_LoadState()
 {
-  if(LoadState()) {
+  int ret = LoadState();
+  if(ret > 0) {
     menu::MessageBox::getInstance().setMessage("Save State Loaded Successfully");
-  } else {
+  } else if(ret == 0) {
     menu::MessageBox::getInstance().setMessage("Save doesn't exist");
+  } else {
+    menu::MessageBox::getInstance().setMessage("Error Loading State");
   }
 }
 
 void Func_SaveState()
 {
-  if(SaveState()) {
+  if(SaveState() > 0) {
     menu::MessageBox::getInstance().setMessage("Save State Saved Successfully");
   } else {
     menu::MessageBox::getInstance().setMessage("Error Saving State");
@@ -349,6 +368,27 @@ void Func_StateCycle()
 
 }
 
+extern "C" void psxSetCpuClock();
+int saveGameSettings();
+
+void Func_CpuClock()
+{
+	cpuClock = (cpuClock + 1) % (CPUCLOCK_3X + 1);
+	strcpy(FRAME_STRINGS[8], cpuClockStrings[(int)cpuClock]);
+	Config.CpuClock = cpuClock;
+	psxSetCpuClock();
+	if(!saveGameSettings())
+		menu::MessageBox::getInstance().setMessage("Failed to save game settings");
+}
+
+void Func_CdSpeed()
+{
+	Config.CdSpeed = (Config.CdSpeed + 1) % (CDSPEED_INSTANT + 1);
+	strcpy(FRAME_STRINGS[9], cdSpeedStrings[Config.CdSpeed]);
+	if(!saveGameSettings())
+		menu::MessageBox::getInstance().setMessage("Failed to save game settings");
+}
+
 void Func_ReturnFromCurrentRomFrame()
 {
 	pMenuContext->setActiveFrame(MenuContext::FRAME_MAIN);
@@ -4,7 +4,7 @@
  *
  * Mupen64 homepage: http://mupen64.emulation64.com
  * email address: hacktarux@yahoo.fr
- * 
+ *
  * If you want to contribute to the project please contact
  * me first (maybe someone is already making what you are
  * planning to do).
@@ -27,13 +27,83 @@
  *
 **/
 
-#include "sys/time.h"
-#include "DEBUG.h"
+/*
+ * Hierarchical zone profiler.
+ *
+ * Each thread that enters a zone gets its own context: a stack of open
+ * zones, per-zone totals and a ring of the most recent completed zones.
+ * Nothing is shared between threads on the hot path, so the emulation,
+ * audio and CDDA threads can all be profiled at once. A zone's exclusive
+ * time is its inclusive time minus that of the zones opened inside it.
+ *
+ * refresh_stat() prints the last second's exclusive time per zone on the
+ * debug overlay, profile_print() dumps the totals and profile_dump_trace()
+ * writes the rings as a Chrome trace (chrome://tracing, Perfetto).
+ */
+
 #include <stdio.h>
+#include <string.h>
+#include <gctypes.h>
+#include "DEBUG.h"
 
 #ifdef PROFILE
 
-char * profile_strings[NUM_SECTIONS] = {
+#ifdef __LINUX__
+#include <time.h>
+#include <pthread.h>
+
+#define PROFILE_TICKS_PER_MS 1000000
+
+static inline u64 profile_ticks(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (u64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static inline unsigned long profile_thread(void)
+{
+	return (unsigned long)pthread_self();
+}
+
+static pthread_mutex_t profile_claim = PTHREAD_MUTEX_INITIALIZER;
+#define CLAIM_LOCK()   pthread_mutex_lock(&profile_claim)
+#define CLAIM_UNLOCK() pthread_mutex_unlock(&profile_claim)
+#else
+#include <ogc/lwp.h>
+#include <ogc/lwp_watchdog.h>
+#include <ogc/machine/processor.h>
+
+#define PROFILE_TICKS_PER_MS TB_TIMER_CLOCK
+
+// Read the time base directly, gettime() is an out of line call
+static inline u64 profile_ticks(void)
+{
+	u32 hi, lo, hi2;
+	do {
+		__asm__ __volatile__ ("mftbu %0" : "=r" (hi));
+		__asm__ __volatile__ ("mftb %0" : "=r" (lo));
+		__asm__ __volatile__ ("mftbu %0" : "=r" (hi2));
+	} while(hi != hi2);
+	return ((u64)hi << 32) | lo;
+}
+
+static inline unsigned long profile_thread(void)
+{
+	return (unsigned long)LWP_GetSelf();
+}
+
+static u32 profile_claim;
+#define CLAIM_LOCK()   _CPU_ISR_Disable(profile_claim)
+#define CLAIM_UNLOCK() _CPU_ISR_Restore(profile_claim)
+#endif
+
+#define PROFILE_MAX_THREADS 4
+#define PROFILE_MAX_DEPTH   16
+#define PROFILE_RING_SIZE   4096	// completed zones kept per thread, power of 2
+#define PROFILE_BUCKETS     32		// log2(ticks) histogram of inclusive times
+
+static const char *profile_strings[NUM_SECTIONS] = {
 	"Total Time",
 	SECTION_NAME_1,
 	SECTION_NAME_2,
@@ -46,77 +116,246 @@ char * profile_strings[NUM_SECTIONS] = {
 	SECTION_NAME_9
 };
 
-extern long long gettime();
-extern unsigned int diff_sec(long long, long long);
+typedef struct {
+	u32 calls;
+	u64 inclusive;
+	u64 exclusive;
+	u32 histogram[PROFILE_BUCKETS];
+} ProfileZone;
+
+typedef struct {
+	u64 start;
+	u32 length;
+	u16 zone;
+	u16 depth;
+} ProfileEvent;
+
+typedef struct {
+	u64 start;
+	u64 children;
+	int zone;
+} ProfileOpen;
+
+typedef struct {
+	volatile unsigned long id;
+	int depth;
+	ProfileOpen stack[PROFILE_MAX_DEPTH];
+	ProfileZone zones[NUM_SECTIONS];
+	u32 head;
+	ProfileEvent ring[PROFILE_RING_SIZE];
+} ProfileThread;
+
+static ProfileThread profile_threads[PROFILE_MAX_THREADS];
+static volatile int profile_num_threads;
+static u64 profile_epoch;
+
+// Totals as of the last refresh_stat(), so the overlay shows one interval
+static ProfileZone last_zones[NUM_SECTIONS];
+static u64 last_refresh;
+
+static ProfileThread *profile_context(void)
+{
+	unsigned long id = profile_thread();
+	ProfileThread *t = NULL;
+	int i;
+
+	for(i=0; i<profile_num_threads; i++)
+		if(profile_threads[i].id == id)
+			return &profile_threads[i];
+
+	// First zone on this thread, claim a context for it
+	CLAIM_LOCK();
+	if(profile_num_threads < PROFILE_MAX_THREADS) {
+		if(!profile_epoch)
+			profile_epoch = profile_ticks();
+		t = &profile_threads[profile_num_threads];
+		t->id = id;
+		profile_num_threads++;
+	}
+	CLAIM_UNLOCK();
+	return t;
+}
 
-static long long time_in_section[NUM_SECTIONS];
-static long long last_start[NUM_SECTIONS];
-static long long last_end[NUM_SECTIONS];
-static long long last_refresh;
+static inline int profile_bucket(u64 ticks)
+{
+	int b = 0;
+	while(ticks > 1 && b < PROFILE_BUCKETS-1) {
+		ticks >>= 1;
+		b++;
+	}
+	return b;
+}
 
+static inline double ticks_to_us(u64 ticks)
+{
+	return (double)ticks * 1000.0 / PROFILE_TICKS_PER_MS;
+}
 
 void start_section(int section_type)
 {
-	last_start[section_type] = gettime();
+	ProfileThread *t = profile_context();
+	ProfileOpen *o;
+
+	if(!t || t->depth >= PROFILE_MAX_DEPTH) return;
+	o = &t->stack[t->depth++];
+	o->zone = section_type;
+	o->children = 0;
+	o->start = profile_ticks();
 }
 
 void end_section(int section_type)
 {
-	if(!last_start[section_type]) return;
-	long long end = gettime();
-	long long amount_not_ours = 0;
-	
-	last_end[section_type] = end;
-	time_in_section[section_type] += (end - last_start[section_type]);
-	
-	// have any other sections opened since ours did? if so, subtract their time from ours.
-	int i, oldest_open_type = 0;
-	long long oldest_open = 0; 
-	for(i=1; i<NUM_SECTIONS; i++) {
-		if(!last_end[i] && last_start[i] && i != section_type && last_start[i] > last_start[section_type] && (last_start[i] < oldest_open || oldest_open == 0)) {
-			oldest_open = last_start[i];
-			oldest_open_type = i;
-		}
+	u64 end = profile_ticks();
+	ProfileThread *t = profile_context();
+	int i;
+
+	if(!t) return;
+
+	// Ending a zone that isn't open (a late exit path) is ignored. Ending
+	// one below the top also closes whatever was left open inside it.
+	for(i=t->depth-1; i>=0; i--)
+		if(t->stack[i].zone == section_type)
+			break;
+	if(i < 0) return;
+
+	while(t->depth > i) {
+		ProfileOpen *o = &t->stack[--t->depth];
+		ProfileZone *z = &t->zones[o->zone];
+		ProfileEvent *e = &t->ring[t->head++ & (PROFILE_RING_SIZE-1)];
+		u64 inclusive = end - o->start;
+
+		z->calls++;
+		z->inclusive += inclusive;
+		z->exclusive += inclusive - o->children;
+		z->histogram[profile_bucket(inclusive)]++;
+		if(t->depth)
+			t->stack[t->depth-1].children += inclusive;
+
+		e->start = o->start;
+		e->length = inclusive > 0xffffffff ? 0xffffffff : (u32)inclusive;
+		e->zone = o->zone;
+		e->depth = t->depth;
+	}
+}
+
+void profile_zone_end(int *section_type)
+{
+	end_section(*section_type);
+}
+
+// Sums every thread's totals for one zone (other threads may be mid-update,
+// which only skews the figures being printed)
+static void profile_collect(int zone, ProfileZone *out)
+{
+	int i, b;
+
+	memset(out, 0, sizeof(ProfileZone));
+	for(i=0; i<profile_num_threads; i++) {
+		ProfileZone *z = &profile_threads[i].zones[zone];
+		out->calls += z->calls;
+		out->inclusive += z->inclusive;
+		out->exclusive += z->exclusive;
+		for(b=0; b<PROFILE_BUCKETS; b++)
+			out->histogram[b] += z->histogram[b];
 	}
-	if(oldest_open > 0) {
-		amount_not_ours = (end-last_start[oldest_open_type]);
+}
+
+// Upper bound, in us, of the bucket that holds the given fraction of calls,
+// 0 without any
+static double profile_percentile(const u32 *histogram, u32 calls, double fraction)
+{
+	u32 wanted = (u32)(calls * fraction), seen = 0;
+	int b;
+
+	if(!calls) return 0;
+
+	for(b=0; b<PROFILE_BUCKETS; b++) {
+		seen += histogram[b];
+		if(seen > wanted) break;
 	}
+	return ticks_to_us((u64)2 << b);
+}
+
+void refresh_stat()
+{
+	char buffer[DEBUG_TEXT_WIDTH];
+	u64 this_tick = profile_ticks();
+	u64 interval = this_tick - last_refresh;
+	int i, b;
+
+	if(interval < (u64)PROFILE_TICKS_PER_MS * 1000) return;
 
-	// have any other sections opened and closed since ours did? if so, subtract their time from ours.
 	for(i=1; i<NUM_SECTIONS; i++) {
-		if(last_start[i] && last_end[i] && i != section_type && last_start[i] > last_start[section_type] && last_end[i] > last_start[section_type]) {
-			amount_not_ours += (time_in_section[i]);
-		}
+		ProfileZone now, delta;
+
+		profile_collect(i, &now);
+		delta.calls = now.calls - last_zones[i].calls;
+		delta.exclusive = now.exclusive - last_zones[i].exclusive;
+		for(b=0; b<PROFILE_BUCKETS; b++)
+			delta.histogram[b] = now.histogram[b] - last_zones[i].histogram[b];
+		last_zones[i] = now;
+
+		if(!last_refresh) continue;
+		// an idle zone keeps its line, without latencies
+		if(!delta.calls)
+			snprintf(buffer, sizeof(buffer), "%s=%.1f%% x0", profile_strings[i],
+				100.0f * (float)delta.exclusive / (float)interval);
+		else
+			snprintf(buffer, sizeof(buffer), "%s=%.1f%% x%u p50 %.0fus p99 %.0fus", profile_strings[i],
+				100.0f * (float)delta.exclusive / (float)interval, delta.calls,
+				profile_percentile(delta.histogram, delta.calls, 0.50),
+				profile_percentile(delta.histogram, delta.calls, 0.99));
+		DEBUG_print(buffer, DBG_PROFILE_BASE+i);
 	}
-	if(amount_not_ours < time_in_section[section_type]) {
-		time_in_section[section_type]-=amount_not_ours;
+	last_refresh = this_tick;
+}
+
+void profile_print(FILE *f)
+{
+	int i;
+
+	fprintf(f, "%-12s %10s %12s %12s %10s %10s %10s\n", "zone", "calls",
+		"incl (ms)", "excl (ms)", "p50 (us)", "p90 (us)", "p99 (us)");
+	for(i=1; i<NUM_SECTIONS; i++) {
+		ProfileZone z;
+
+		profile_collect(i, &z);
+		if(!z.calls) continue;
+		fprintf(f, "%-12s %10u %12.3f %12.3f %10.0f %10.0f %10.0f\n", profile_strings[i], z.calls,
+			ticks_to_us(z.inclusive) / 1000.0, ticks_to_us(z.exclusive) / 1000.0,
+			profile_percentile(z.histogram, z.calls, 0.50),
+			profile_percentile(z.histogram, z.calls, 0.90),
+			profile_percentile(z.histogram, z.calls, 0.99));
 	}
 }
 
-void refresh_stat()
+int profile_dump_trace(const char *path)
 {
-	long long this_tick = gettime();
-	if(diff_sec(last_refresh, this_tick) >= 1) {
-		time_in_section[0] = this_tick - last_start[0];
-
-		int i;
-		long long all_sections = 0;
-		for(i=1; i<NUM_SECTIONS; i++) {
-			sprintf(txtbuffer, "%s=%f%%",profile_strings[i], 100.0f * (float)time_in_section[i] / (float)time_in_section[0]);
-			DEBUG_print(txtbuffer, DBG_PROFILE_BASE+i);
-			all_sections += time_in_section[i];
-			last_start[i] = 0;
-			last_end[i] = 0;
-			time_in_section[i] = 0;
-		}
-		sprintf(txtbuffer, "unknown=%f%%  %llu %llu", 100.0f * ((float)(time_in_section[0]-all_sections) / (float)time_in_section[0])
-			, time_in_section[0]
-			, all_sections);
-		DEBUG_print(txtbuffer, NUM_SECTIONS);
+	FILE *f = fopen(path, "w");
+	const char *sep = "";
+	int i;
+
+	if(!f) return -1;
 
-		last_start[0] = this_tick;
-		last_refresh = this_tick;
+	fprintf(f, "{\"traceEvents\":[\n");
+	for(i=0; i<profile_num_threads; i++) {
+		ProfileThread *t = &profile_threads[i];
+		u32 n = t->head < PROFILE_RING_SIZE ? t->head : PROFILE_RING_SIZE;
+		u32 j;
+
+		fprintf(f, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,"
+			"\"args\":{\"name\":\"thread %d\"}}", sep, i, i);
+		sep = ",\n";
+		for(j=t->head-n; j!=t->head; j++) {
+			ProfileEvent *e = &t->ring[j & (PROFILE_RING_SIZE-1)];
+			fprintf(f, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,"
+				"\"ts\":%.3f,\"dur\":%.3f}", profile_strings[e->zone], i,
+				ticks_to_us(e->start - profile_epoch), ticks_to_us(e->length));
+		}
 	}
+	fprintf(f, "\n]}\n");
+	fclose(f);
+	return 0;
 }
 
 #endif
@@ -133,6 +133,31 @@ enum dynacore
 	DYNACORE_INTERPRETER,
 };
 
+extern char cpuClock;	//Config.CpuClock, saved per game
+enum cpuClock
+{
+	CPUCLOCK_1X=0,
+	CPUCLOCK_1_5X,
+	CPUCLOCK_2X,
+	CPUCLOCK_3X
+};
+
+extern char cdSpeed;	//default Config.CdSpeed, games can override it
+enum cdSpeed
+{
+	CDSPEED_NORMAL=0,
+	CDSPEED_4X,
+	CDSPEED_8X,
+	CDSPEED_INSTANT
+};
+
+extern char spuCapture;	//settings.cfg only, records sd:/wiisx/spu.trace
+enum spuCapture
+{
+	SPUCAPTURE_DISABLE=0,
+	SPUCAPTURE_ENABLE
+};
+
 extern char biosDevice;
 enum biosDevice
 {
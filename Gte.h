@@ -59,6 +59,30 @@ void gteGPF();
 void gteGPL();
 void gteNCCT();
 
+// same results, FLAG left alone (gte_nf.c)
+void gteRTPS_nf();
+void gteOP_nf();
+void gteNCLIP_nf();
+void gteDPCS_nf();
+void gteINTPL_nf();
+void gteMVMVA_nf();
+void gteNCDS_nf();
+void gteNCDT_nf();
+void gteCDP_nf();
+void gteNCCS_nf();
+void gteCC_nf();
+void gteNCS_nf();
+void gteNCT_nf();
+void gteSQR_nf();
+void gteDCPL_nf();
+void gteDPCT_nf();
+void gteAVSZ3_nf();
+void gteAVSZ4_nf();
+void gteRTPT_nf();
+void gteGPF_nf();
+void gteGPL_nf();
+void gteNCCT_nf();
+
 #ifdef __cplusplus
 }
 #endif
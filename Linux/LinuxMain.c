@@ -0,0 +1,566 @@
+//LinuxMain.c pcsxbench main loop and host plugin glue
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version. See also the license.txt file for *
+ *   additional informations.                                              *
+ *                                                                         *
+ ***************************************************************************/
+
+/*
+* Headless host frontend. Runs a disc image or PS-EXE for a fixed number of
+* frames as fast as the host allows, then reports the emulated frame rate,
+* the time spent in each plugin and hashes of RAM and VRAM, so two builds
+* can be compared for both speed and behaviour.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include "../PsxCommon.h"
+#include "../R3000A.h"
+#include "../Misc.h"
+#include "../PsxProf.h"
+#include "../PsxTrace.h"
+#include "../SpuTrace.h"
+#include "../plugins.h"
+#include "../cdriso.h"
+#include "../Gamecube/GamecubePlugins.h"
+#include "../Gamecube/DEBUG.h"
+#include "../Gamecube/MEM2.h"
+#include "../Gamecube/wiiSXconfig.h"
+#include "../Gamecube/xxhash.h"
+#include "../Gamecube/fileBrowser/fileBrowser.h"
+
+extern unsigned short *psxVuw;
+
+char MEM2_host[MEM2_SIZE] __attribute__((aligned(32)));
+
+fileBrowser_file isoFile;  //the ISO file
+fileBrowser_file cddaFile; //the CDDA file
+fileBrowser_file subFile;  //the SUB file
+fileBrowser_file *biosFile = NULL;  //BIOS file
+
+PcsxConfig Config;
+R3000Acpu psxRec;	// no recompiler on the host, Config.Cpu stays on the interpreter
+
+// Settings the core and the plugins read from the Wii frontend
+char dynacore = DYNACORE_INTERPRETER;
+char cpuClock = CPUCLOCK_1X;
+char cdSpeed = CDSPEED_NORMAL;
+char biosDevice = BIOSDEVICE_HLE;
+char LoadCdBios = 0;
+char frameLimit = FRAMELIMIT_NONE;
+char frameSkip = FRAMESKIP_DISABLE;
+char showFPSonScreen = FPS_HIDE;
+char menuActive = 0;
+char saveStateDevice = SAVESTATEDEVICE_SD;
+char screenMode = 0;
+
+int stop = 0;
+
+static u32 benchFrames = 600;
+static int benchHotspots = 0;
+static u32 framesDone = 0;
+
+////////////////////////////////////////////////////////////////////////
+// Host file access for the fileBrowser users (PS-EXE and BIOS loading)
+////////////////////////////////////////////////////////////////////////
+
+static int fileBrowser_host_open(fileBrowser_file* file) {
+	FILE* f = fopen(file->name, "rb");
+
+	if(!f) return FILE_BROWSER_ERROR_NO_FILE;
+	fseek(f, 0, SEEK_END);
+	file->size = ftell(f);
+	file->offset = 0;
+	file->attr = 0;
+	fclose(f);
+	return 0;
+}
+
+static int fileBrowser_host_readFile(fileBrowser_file* file, void* buffer, unsigned int length) {
+	FILE* f = fopen(file->name, "rb");
+	int bytes_read;
+
+	if(!f) return FILE_BROWSER_ERROR;
+	fseek(f, file->offset, SEEK_SET);
+	bytes_read = fread(buffer, 1, length, f);
+	if(bytes_read > 0) file->offset += bytes_read;
+	fclose(f);
+	return bytes_read;
+}
+
+static int fileBrowser_host_seekFile(fileBrowser_file* file, unsigned int where, unsigned int type) {
+	if(type == FILE_BROWSER_SEEK_SET) file->offset = where;
+	else if(type == FILE_BROWSER_SEEK_CUR) file->offset += where;
+	else file->offset = file->size + where;
+	return 0;
+}
+
+static int fileBrowser_host_init(fileBrowser_file* file) {
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////
+// Pads: a standard pad on each port with nothing pressed
+////////////////////////////////////////////////////////////////////////
+
+static unsigned char padBuf[] = { 0x00, 0x41, 0x5a, 0xff, 0xff };
+static int padPos;
+
+long PAD__init(long flags) { return PSE_PAD_ERR_SUCCESS; }
+long PAD__shutdown(void) { return PSE_PAD_ERR_SUCCESS; }
+long PAD__open(void) { return PSE_PAD_ERR_SUCCESS; }
+long PAD__close(void) { return PSE_PAD_ERR_SUCCESS; }
+
+unsigned char PAD__startPoll(int pad) {
+	padPos = 0;
+	return padBuf[padPos++];
+}
+
+unsigned char PAD__poll(const unsigned char value) {
+	if(padPos >= sizeof(padBuf)) return 0;
+	return padBuf[padPos++];
+}
+
+long PAD__readPort1(PadDataS* pad) {
+	pad->controllerType = PSE_PAD_TYPE_STANDARD;
+	pad->buttonStatus = 0xffff;
+	return PSE_PAD_ERR_SUCCESS;
+}
+
+long PAD__readPort2(PadDataS* pad) {
+	pad->controllerType = PSE_PAD_TYPE_STANDARD;
+	pad->buttonStatus = 0xffff;
+	return PSE_PAD_ERR_SUCCESS;
+}
+
+PluginTable plugins[] =
+	{ EMPTY_PLUGIN,
+	  PAD1_PLUGIN,
+	  PAD2_PLUGIN,
+	  CDRISO_PLUGIN,
+	  FRANSPU_PLUGIN,
+	  GPU_PEOPS_PLUGIN,
+	  EMPTY_PLUGIN,
+	  EMPTY_PLUGIN };
+
+////////////////////////////////////////////////////////////////////////
+// Per-plugin timing
+////////////////////////////////////////////////////////////////////////
+
+enum {
+	BENCH_GPU = 0,
+	BENCH_SPU,
+	BENCH_CDR,
+	BENCH_NUM
+};
+
+static const char *benchNames[BENCH_NUM] = { "gpu", "spu", "cdrom" };
+static u64 benchTime[BENCH_NUM];
+static u32 benchCalls[BENCH_NUM];
+
+static u64 benchClock(void) {
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (u64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// Status reads are left unwrapped: games busy-poll GPUSTAT and SPUSTAT, and
+// two clock reads per poll would cost more than the poll itself. Their time
+// is counted as core time.
+#define TIMED(sys, call) { \
+	u64 t0 = benchClock(); \
+	call; \
+	benchTime[sys] += benchClock() - t0; \
+	benchCalls[sys]++; \
+}
+
+static GPUreadData            real_GPU_readData;
+static GPUreadDataMem         real_GPU_readDataMem;
+static GPUwriteStatus         real_GPU_writeStatus;
+static GPUwriteData           real_GPU_writeData;
+static GPUwriteDataMem        real_GPU_writeDataMem;
+static GPUdmaChain            real_GPU_dmaChain;
+static GPUupdateLace          real_GPU_updateLace;
+
+static uint32_t CALLBACK timed_GPU_readData(void) { uint32_t r; TIMED(BENCH_GPU, r = real_GPU_readData()); return r; }
+static void CALLBACK timed_GPU_readDataMem(uint32_t *p, int n) { TIMED(BENCH_GPU, real_GPU_readDataMem(p, n)); }
+static void CALLBACK timed_GPU_writeStatus(uint32_t v) { TIMED(BENCH_GPU, real_GPU_writeStatus(v)); }
+static void CALLBACK timed_GPU_writeData(uint32_t v) { TIMED(BENCH_GPU, real_GPU_writeData(v)); }
+static void CALLBACK timed_GPU_writeDataMem(uint32_t *p, int n) { TIMED(BENCH_GPU, real_GPU_writeDataMem(p, n)); }
+static long CALLBACK timed_GPU_dmaChain(uint32_t *p, uint32_t a) { long r; TIMED(BENCH_GPU, r = real_GPU_dmaChain(p, a)); return r; }
+static void CALLBACK timed_GPU_updateLace(void) { TIMED(BENCH_GPU, real_GPU_updateLace()); }
+
+static SPUwriteRegister       real_SPU_writeRegister;
+static SPUwriteDMA            real_SPU_writeDMA;
+static SPUreadDMA             real_SPU_readDMA;
+static SPUwriteDMAMem         real_SPU_writeDMAMem;
+static SPUreadDMAMem          real_SPU_readDMAMem;
+static SPUplayADPCMchannel    real_SPU_playADPCMchannel;
+static SPUasync               real_SPU_async;
+
+static void CALLBACK timed_SPU_writeRegister(unsigned long r, unsigned short v) { TIMED(BENCH_SPU, real_SPU_writeRegister(r, v)); }
+static void CALLBACK timed_SPU_writeDMA(unsigned short v) { TIMED(BENCH_SPU, real_SPU_writeDMA(v)); }
+static unsigned short CALLBACK timed_SPU_readDMA(void) { unsigned short v; TIMED(BENCH_SPU, v = real_SPU_readDMA()); return v; }
+static void CALLBACK timed_SPU_writeDMAMem(unsigned short *p, int n) { TIMED(BENCH_SPU, real_SPU_writeDMAMem(p, n)); }
+static void CALLBACK timed_SPU_readDMAMem(unsigned short *p, int n) { TIMED(BENCH_SPU, real_SPU_readDMAMem(p, n)); }
+static void CALLBACK timed_SPU_playADPCMchannel(xa_decode_t *xap) { TIMED(BENCH_SPU, real_SPU_playADPCMchannel(xap)); }
+static void CALLBACK timed_SPU_async(uint32_t cycle) { TIMED(BENCH_SPU, real_SPU_async(cycle)); }
+
+static CDRreadTrack           real_CDR_readTrack;
+static CDRgetBuffer           real_CDR_getBuffer;
+static CDRgetBufferSub        real_CDR_getBufferSub;
+static CDRgetTN               real_CDR_getTN;
+static CDRgetTD               real_CDR_getTD;
+static CDRgetStatus           real_CDR_getStatus;
+
+static long CALLBACK timed_CDR_readTrack(unsigned char *t) { long r; TIMED(BENCH_CDR, r = real_CDR_readTrack(t)); return r; }
+static unsigned char* CALLBACK timed_CDR_getBuffer(void) { unsigned char *r; TIMED(BENCH_CDR, r = real_CDR_getBuffer()); return r; }
+static unsigned char* CALLBACK timed_CDR_getBufferSub(void) { unsigned char *r; TIMED(BENCH_CDR, r = real_CDR_getBufferSub()); return r; }
+static long CALLBACK timed_CDR_getTN(unsigned char *b) { long r; TIMED(BENCH_CDR, r = real_CDR_getTN(b)); return r; }
+static long CALLBACK timed_CDR_getTD(unsigned char t, unsigned char *b) { long r; TIMED(BENCH_CDR, r = real_CDR_getTD(t, b)); return r; }
+static long CALLBACK timed_CDR_getStatus(struct CdrStat *s) { long r; TIMED(BENCH_CDR, r = real_CDR_getStatus(s)); return r; }
+
+#define WRAP(name) { real_##name = name; name = timed_##name; }
+
+// Route the calls the core makes into the plugins through the timers
+static void benchWrapPlugins(void) {
+	WRAP(GPU_readData);
+	WRAP(GPU_readDataMem);
+	WRAP(GPU_writeStatus);
+	WRAP(GPU_writeData);
+	WRAP(GPU_writeDataMem);
+	WRAP(GPU_dmaChain);
+	WRAP(GPU_updateLace);
+
+	WRAP(SPU_writeRegister);
+	WRAP(SPU_writeDMA);
+	WRAP(SPU_readDMA);
+	WRAP(SPU_writeDMAMem);
+	WRAP(SPU_readDMAMem);
+	WRAP(SPU_playADPCMchannel);
+	WRAP(SPU_async);
+
+	WRAP(CDR_readTrack);
+	WRAP(CDR_getBuffer);
+	WRAP(CDR_getBufferSub);
+	WRAP(CDR_getTN);
+	WRAP(CDR_getTD);
+	WRAP(CDR_getStatus);
+}
+
+static void benchReport(u64 elapsed) {
+	double secs = elapsed / 1e9;
+	double fps = secs > 0 ? framesDone / secs : 0;
+	double rate = Config.PsxType == PSX_TYPE_PAL ? 50.0 : 60.0;
+	u64 plugins = 0;
+	int i;
+
+	printf("%u frames in %.3f s: %.1f fps (%.2fx %s)\n", framesDone, secs, fps,
+		fps / rate, Config.PsxType == PSX_TYPE_PAL ? "PAL" : "NTSC");
+
+	for(i = 0; i < BENCH_NUM; i++)
+		plugins += benchTime[i];
+	printf("  %-6s %8.3f s %5.1f%%\n", "core", (elapsed - plugins) / 1e9,
+		elapsed ? 100.0 * (elapsed - plugins) / elapsed : 0);
+	for(i = 0; i < BENCH_NUM; i++)
+		printf("  %-6s %8.3f s %5.1f%% %10u calls\n", benchNames[i], benchTime[i] / 1e9,
+			elapsed ? 100.0 * benchTime[i] / elapsed : 0, benchCalls[i]);
+
+	printf("  ram    xxh32 %08x\n", XXH32(psxCore.psxM, 0x200000, 0));
+	printf("  vram   xxh32 %08x\n", XXH32(psxVuw, 1024 * 512 * 2, 0));
+}
+
+////////////////////////////////////////////////////////////////////////
+// libogc timebase, used by the soft GPU's fps counter
+////////////////////////////////////////////////////////////////////////
+
+long long gettime(void) {
+	return benchClock() / 1000;
+}
+
+unsigned int diff_usec(long long start, long long end) {
+	return end - start;
+}
+
+////////////////////////////////////////////////////////////////////////
+// System functions
+////////////////////////////////////////////////////////////////////////
+
+// A PS-EXE runs with the drive empty rather than failing OpenPlugins
+static long CALLBACK noDisc_open(void) { return 0; }
+
+int SysInit() {
+	Config.Cpu = CPU_INTERPRETER;
+	psxInit();
+	if(LoadPlugins() < 0)
+		return -1;
+	if(!UsingIso())
+		CDR_open = noDisc_open;
+	benchWrapPlugins();
+	if(OpenPlugins() < 0)
+		return -1;
+	return 0;
+}
+
+void SysReset() {
+	psxReset();
+}
+
+void SysClose() {
+	SpuTraceStop();
+	psxShutdown();
+	ClosePlugins();
+	ReleasePlugins();
+}
+
+void SysPrintf(const char *fmt, ...) {
+	va_list list;
+
+	if(!Config.PsxOut) return;
+	va_start(list, fmt);
+	vprintf(fmt, list);
+	va_end(list);
+}
+
+void SysMessage(const char *fmt, ...) {
+	va_list list;
+
+	va_start(list, fmt);
+	vfprintf(stderr, fmt, list);
+	va_end(list);
+	fprintf(stderr, "\n");
+}
+
+void *SysLoadLibrary(const char *lib) {
+	int i;
+	for(i=0; i<NUM_PLUGINS; i++)
+		if((plugins[i].lib != NULL) && (!strcmp(lib, plugins[i].lib)))
+			return (void*)(uptr)i;
+	return NULL;
+}
+
+void *SysLoadSym(void *lib, const char *sym) {
+	PluginTable* plugin = plugins + (uptr)lib;
+	int i;
+	for(i=0; i<plugin->numSyms; i++)
+		if(plugin->syms[i].sym && !strcmp(sym, plugin->syms[i].sym))
+			return plugin->syms[i].pntr;
+	return NULL;
+}
+
+const char *SysLibError() { return NULL; }
+void SysCloseLibrary(void *lib) {}
+void SysRunGui() {}
+
+void print_gecko(const char *fmt, ...) {
+	va_list list;
+
+	if(!Config.PsxOut) return;
+	va_start(list, fmt);
+	vprintf(fmt, list);
+	va_end(list);
+}
+
+void LoadingBar_showBar(float percent, const char* string) {}
+void DEBUG_print(char* string, int pos) {}
+
+// Called once per emulated frame
+void SysUpdate() {
+	if(++framesDone >= benchFrames)
+		stop = 1;
+}
+
+// Plays an SPU trace through franspu with no CPU running and reports the
+// time spent in each SPU entry point
+static int spuReplay(const char *trace, const char *wav) {
+	SpuTraceStats stats;
+	int ret;
+
+	Config.PsxOut = 1;
+	Config.Cpu = CPU_INTERPRETER;
+	strcpy(Config.Net, "Disabled");
+	Config.HLE = BIOS_HLE;
+	SetIsoFile(NULL);
+
+	psxInit();
+	if(LoadPlugins() < 0)
+		return -1;
+	CDR_open = noDisc_open;
+	if(OpenPlugins() < 0)
+		return -1;
+
+	ret = SpuTraceReplay(trace, wav, 1, &stats);
+	SpuTracePrintStats(&stats);
+	SysClose();
+	return ret;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+static void usage(const char *name) {
+	printf("Usage: %s [options] <image.cue|image.bin|image.iso|program.exe>\n"
+		"       %s -events2json EVENTS JSON\n"
+		"       %s -spureplay TRACE WAV\n"
+		"\t-frames N\tRun N emulated frames (default %u)\n"
+		"\t-bios FILE\tBoot through a BIOS image instead of the HLE BIOS\n"
+		"\t-clock N\tCPU clock: 0 = 1x, 1 = 1.5x, 2 = 2x, 3 = 3x\n"
+		"\t-cdspeed N\tCD data reads: 0 = normal, 1 = 4x, 2 = 8x, 3 = instant\n"
+		"\t-psxout\t\tPrint the program's TTY output\n"
+		"\t-hotspots N\tList the N hottest guest blocks, BIOS calls and registers\n"
+		"\t-events FILE\tSave the last interrupts, DMAs, CD commands and frames\n"
+		"\t-sputrace FILE\tCapture every SPU call for -spureplay (adds to the spu time)\n"
+#ifdef PROFILE
+		"\t-trace FILE\tWrite the profiled zones as a Chrome trace\n"
+#endif
+		, name, name, name, benchFrames);
+}
+
+int main(int argc, char *argv[]) {
+	static fileBrowser_file biosHostFile;
+	const char *image = NULL;
+	const char *trace = NULL;
+	const char *events = NULL;
+	const char *spuTrace = NULL;
+	const char *ext;
+	u64 start;
+	int i;
+
+	if(argc == 4 && !strcmp(argv[1], "-events2json")) {
+		if(PsxTraceConvert(argv[2], argv[3]) < 0) {
+			SysMessage("Could not convert %s", argv[2]);
+			return 1;
+		}
+		return 0;
+	}
+	if(argc == 4 && !strcmp(argv[1], "-spureplay"))
+		return spuReplay(argv[2], argv[3]) < 0 ? 1 : 0;
+
+	for(i = 1; i < argc; i++) {
+		if(!strcmp(argv[i], "-frames") && i + 1 < argc)
+			benchFrames = strtoul(argv[++i], NULL, 0);
+		else if(!strcmp(argv[i], "-bios") && i + 1 < argc) {
+			strncpy(biosHostFile.name, argv[++i], FILE_BROWSER_MAX_PATH_LEN - 1);
+			biosDevice = BIOSDEVICE_SD;
+		}
+		else if(!strcmp(argv[i], "-clock") && i + 1 < argc)
+			cpuClock = atoi(argv[++i]);
+		else if(!strcmp(argv[i], "-cdspeed") && i + 1 < argc)
+			cdSpeed = atoi(argv[++i]);
+		else if(!strcmp(argv[i], "-psxout"))
+			Config.PsxOut = 1;
+		else if(!strcmp(argv[i], "-hotspots") && i + 1 < argc)
+			benchHotspots = atoi(argv[++i]);
+		else if(!strcmp(argv[i], "-events") && i + 1 < argc)
+			events = argv[++i];
+		else if(!strcmp(argv[i], "-sputrace") && i + 1 < argc)
+			spuTrace = argv[++i];
+#ifdef PROFILE
+		else if(!strcmp(argv[i], "-trace") && i + 1 < argc)
+			trace = argv[++i];
+#endif
+		else if(argv[i][0] != '-' && !image)
+			image = argv[i];
+		else {
+			usage(argv[0]);
+			return 1;
+		}
+	}
+	if(!image || !benchFrames) {
+		usage(argv[0]);
+		return 1;
+	}
+
+	strcpy(Config.Net, "Disabled");
+	Config.HLE = BIOS_HLE;
+	Config.Xa = 0;
+	Config.Cdda = 1;	// CDDA streams on a wall-clock thread, keep it out
+	Config.PsxAuto = 1;
+	Config.CpuClock = cpuClock;
+	Config.CdSpeed = cdSpeed > CD_SPEED_INSTANT ? CD_SPEED_NORMAL : cdSpeed;
+
+	isoFile_readFile = fileBrowser_host_readFile;
+	isoFile_seekFile = fileBrowser_host_seekFile;
+	isoFile_open = fileBrowser_host_open;
+	isoFile_init = fileBrowser_host_init;
+
+	if(biosDevice != BIOSDEVICE_HLE) {
+		if(fileBrowser_host_open(&biosHostFile) < 0) {
+			SysMessage("Could not open BIOS %s", biosHostFile.name);
+			return 1;
+		}
+		biosFile = &biosHostFile;
+		biosFile_readFile = fileBrowser_host_readFile;
+		biosFile_open = fileBrowser_host_open;
+		Config.HLE = BIOS_USER_DEFINED;
+	}
+
+	memset(&isoFile, 0, sizeof(fileBrowser_file));
+	strncpy(isoFile.name, image, FILE_BROWSER_MAX_PATH_LEN - 1);
+	if(fileBrowser_host_open(&isoFile) < 0) {
+		SysMessage("Could not open %s", image);
+		return 1;
+	}
+
+	ext = strrchr(image, '.');
+	if(ext && !strcasecmp(ext, ".exe"))
+		SetIsoFile(NULL);
+	else
+		SetIsoFile(image);
+
+	if(SysInit() < 0) {
+		SysMessage("Could not initialise the emulator");
+		return 1;
+	}
+	psxSetCpuClock();
+	SysReset();
+	if(benchHotspots)
+		PsxProfStart(256);
+	if(events && PsxTraceStart() < 0) {
+		SysMessage("Could not allocate the event trace");
+		return 1;
+	}
+	if(spuTrace && SpuTraceStart(spuTrace) < 0) {
+		SysMessage("Could not create %s", spuTrace);
+		return 1;
+	}
+
+	if(!UsingIso()) {
+		if(Load(&isoFile) < 0) {
+			SysMessage("Could not load %s", image);
+			return 1;
+		}
+	}
+	else {
+		if(CheckCdrom() < 0) {
+			SysMessage("Could not read %s", image);
+			return 1;
+		}
+		LoadCdrom();
+	}
+
+	start = benchClock();
+	stop = 0;
+	psxCpu->Execute();
+	benchReport(benchClock() - start);
+	if(benchHotspots)
+		PsxProfDump(stdout, benchHotspots);
+	if(events && PsxTraceSave(events) < 0)
+		SysMessage("Could not write %s", events);
+#ifdef PROFILE
+	profile_print(stdout);
+	if(trace && profile_dump_trace(trace) < 0)
+		SysMessage("Could not write %s", trace);
+#endif
+
+	SysClose();
+	return 0;
+}
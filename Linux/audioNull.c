@@ -0,0 +1,56 @@
+//audioNull.c AUDIO output for the headless host build
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version. See also the license.txt file for *
+ *   additional informations.                                              *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "../franspu/franspu.h"
+#include "../PsxCommon.h"
+#include "../SpuTrace.h"
+
+// Mixed blocks are dropped (or handed to an SPU trace replay). Nothing is
+// ever buffered, so the mixer runs every time it is asked to and the
+// benchmark pays the full SPU cost.
+
+char audioEnabled;
+unsigned long audioBytes;
+
+void SetVolume(void)
+{
+}
+
+void SetupSound(void)
+{
+	audioBytes = 0;
+}
+
+void RemoveSound(void)
+{
+}
+
+unsigned long SoundGetBytesBuffered(void)
+{
+	return 0;
+}
+
+void SoundFeedStreamData(unsigned char* pSound,long lBytes)
+{
+	if(SpuTraceSink) {
+		SpuTraceSink(pSound, lBytes);
+		return;
+	}
+
+	audioBytes += lBytes;
+}
+
+void pauseAudio(void){
+}
+
+void resumeAudio(void){
+}
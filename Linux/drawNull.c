@@ -0,0 +1,97 @@
+/***************************************************************************
+    drawNull.c
+    PeopsSoftGPU display backend for the headless host build.
+
+    The soft renderer draws straight into psxVuw, so there is nothing to
+    present: the frame stays in emulated VRAM where the benchmark hashes it.
+ ***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version. See also the license.txt file for *
+ *   additional informations.                                              *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "../PeopsSoftGPU/stdafx.h"
+#define _IN_DRAW
+#include "../PeopsSoftGPU/externals.h"
+#include "../PeopsSoftGPU/gpu.h"
+#include "../PeopsSoftGPU/draw.h"
+#include "../PeopsSoftGPU/prim.h"
+#include "../PeopsSoftGPU/menu.h"
+
+////////////////////////////////////////////////////////////////////////////////////
+// misc globals
+////////////////////////////////////////////////////////////////////////////////////
+int            iResX;
+int            iResY;
+long           lLowerpart;
+BOOL           bIsFirstFrame = TRUE;
+BOOL           bCheckMask=FALSE;
+unsigned short sSetMask=0;
+unsigned long  lSetMask=0;
+int            iDesktopCol=16;
+int            iShowFPS=0;
+int            iWinSize;
+int            iUseScanLines=0;
+int            iUseNoStretchBlt=0;
+int            iFastFwd=0;
+int            iDebugMode=0;
+int            iFVDisplay=0;
+PSXPoint_t     ptCursorPoint[8];
+unsigned short usCursorActive=0;
+
+int            iResX_Max=1024;
+int            iResY_Max=512;
+char *         pCaptionText;
+
+void DoBufferSwap(void)
+{
+}
+
+void DoClearScreenBuffer(void)
+{
+}
+
+void DoClearFrontBuffer(void)
+{
+}
+
+unsigned long ulInitDisplay(void)
+{
+	bUsingTWin=FALSE;
+
+	InitMenu();
+
+	bIsFirstFrame = FALSE;
+
+	return 1;
+}
+
+void CloseDisplay(void)
+{
+}
+
+void CreatePic(unsigned char * pMem)
+{
+}
+
+void DestroyPic(void)
+{
+}
+
+void DisplayPic(void)
+{
+}
+
+void ShowGpuPic(void)
+{
+}
+
+void ShowTextGpuPic(void)
+{
+}
@@ -0,0 +1,16 @@
+/* gccore.h - host stand-in for the libogc umbrella header
+ */
+
+#ifndef __GCCORE_H__
+#define __GCCORE_H__
+
+#include "gctypes.h"
+#include "ogc/lwp.h"
+#include "ogc/mutex.h"
+#include "ogc/cond.h"
+
+#define DCFlushRange(addr, len)
+#define DCInvalidateRange(addr, len)
+#define ICInvalidateRange(addr, len)
+
+#endif
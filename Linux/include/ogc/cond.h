@@ -0,0 +1,47 @@
+/* cond.h - libogc condition variables on top of pthreads for the host build
+ */
+
+#ifndef __COND_H__
+#define __COND_H__
+
+#include <pthread.h>
+#include <stdlib.h>
+#include "gctypes.h"
+#include "ogc/mutex.h"
+
+#define LWP_COND_NULL		NULL
+
+typedef pthread_cond_t *cond_t;
+
+static inline s32 LWP_CondInit(cond_t *cond)
+{
+	*cond = malloc(sizeof(pthread_cond_t));
+	if (!*cond)
+		return -1;
+	pthread_cond_init(*cond, NULL);
+	return 0;
+}
+
+static inline s32 LWP_CondDestroy(cond_t cond)
+{
+	pthread_cond_destroy(cond);
+	free(cond);
+	return 0;
+}
+
+static inline s32 LWP_CondWait(cond_t cond, mutex_t mutex)
+{
+	return pthread_cond_wait(cond, mutex);
+}
+
+static inline s32 LWP_CondSignal(cond_t cond)
+{
+	return pthread_cond_signal(cond);
+}
+
+static inline s32 LWP_CondBroadcast(cond_t cond)
+{
+	return pthread_cond_broadcast(cond);
+}
+
+#endif
@@ -0,0 +1,50 @@
+/* lwp.h - libogc threads on top of pthreads for the host build
+ */
+
+#ifndef __LWP_H__
+#define __LWP_H__
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include "gctypes.h"
+
+#define LWP_THREAD_NULL		NULL
+#define LWP_PRIO_IDLE		0
+#define LWP_PRIO_HIGHEST	127
+
+typedef pthread_t *lwp_t;
+
+// The stack and priority are the console's business; the host scheduler
+// picks its own.
+static inline s32 LWP_CreateThread(lwp_t *thethread, void *(*entry)(void *), void *arg,
+		void *stackbase, u32 stack_size, u8 prio)
+{
+	pthread_t *thread = malloc(sizeof(pthread_t));
+
+	if (!thread || pthread_create(thread, NULL, entry, arg)) {
+		free(thread);
+		*thethread = LWP_THREAD_NULL;
+		return -1;
+	}
+	*thethread = thread;
+	return 0;
+}
+
+static inline s32 LWP_JoinThread(lwp_t thethread, void **value_ptr)
+{
+	s32 ret;
+
+	if (thethread == LWP_THREAD_NULL)
+		return -1;
+	ret = pthread_join(*thethread, value_ptr);
+	free(thethread);
+	return ret;
+}
+
+static inline void LWP_YieldThread(void)
+{
+	sched_yield();
+}
+
+#endif
@@ -0,0 +1,52 @@
+/* mutex.h - libogc mutexes on top of pthreads for the host build
+ */
+
+#ifndef __MUTEX_H__
+#define __MUTEX_H__
+
+#include <pthread.h>
+#include <stdlib.h>
+#include "gctypes.h"
+
+#define LWP_MUTEX_NULL		NULL
+
+typedef pthread_mutex_t *mutex_t;
+
+static inline s32 LWP_MutexInit(mutex_t *mutex, int use_recursive)
+{
+	pthread_mutexattr_t attr;
+
+	*mutex = malloc(sizeof(pthread_mutex_t));
+	if (!*mutex)
+		return -1;
+	pthread_mutexattr_init(&attr);
+	if (use_recursive)
+		pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+	pthread_mutex_init(*mutex, &attr);
+	pthread_mutexattr_destroy(&attr);
+	return 0;
+}
+
+static inline s32 LWP_MutexDestroy(mutex_t mutex)
+{
+	pthread_mutex_destroy(mutex);
+	free(mutex);
+	return 0;
+}
+
+static inline s32 LWP_MutexLock(mutex_t mutex)
+{
+	return pthread_mutex_lock(mutex);
+}
+
+static inline s32 LWP_MutexTryLock(mutex_t mutex)
+{
+	return pthread_mutex_trylock(mutex);
+}
+
+static inline s32 LWP_MutexUnlock(mutex_t mutex)
+{
+	return pthread_mutex_unlock(mutex);
+}
+
+#endif
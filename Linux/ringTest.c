@@ -0,0 +1,150 @@
+//ringTest.c Host test for the franspu audio ring
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version. See also the license.txt file for *
+ *   additional informations.                                              *
+ *                                                                         *
+ ***************************************************************************/
+
+/*
+* The mixer and the voice callback take turns on one core on the console,
+* so the test interleaves them the same way: a producer writing blocks of
+* random size and a consumer taking chunks at random moments. Every byte
+* is a running counter, so a chunk that skips, repeats or reorders data
+* shows up at once; the run goes around the ring many times.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../franspu/spu_ring.h"
+
+#define FREQ		44100
+#define TOTAL		(64 * RING_SIZE)
+
+static int failures;
+
+#define CHECK(cond, ...) do { \
+	if (!(cond)) { \
+		printf(__VA_ARGS__); \
+		printf("\n"); \
+		failures++; \
+	} \
+} while (0)
+
+static void testStream() {
+	u8 block[4096];
+	u32 produced = 0, consumed = 0, playing = 0, dropped = 0, wraps = 0;
+	u8 *base;
+	u32 i;
+
+	srand(1);
+	RingReset();
+	RingPlay(&base);	// the start of the ring while it's empty
+
+	while (consumed < TOTAL && failures == 0) {
+		if (rand() & 1) {
+			u32 len = rand() % sizeof(block) + 1, n;
+
+			for (i = 0; i < len; i++)
+				block[i] = (u8)(produced + i);
+			n = RingWrite(block, len);
+			CHECK(n <= len, "wrote %u of %u", n, len);
+			if (n < len) dropped++;
+			produced += n;
+			CHECK(RingFill() <= RING_SIZE, "fill %u past the ring", RingFill());
+			// the chunk being played still counts until the next one is taken
+			CHECK(RingFill() == produced - consumed + playing, "fill %u, expected %u",
+				  RingFill(), produced - consumed + playing);
+		} else {
+			u8 *chunk;
+			u32 len = RingPlay(&chunk);
+			u32 at = consumed & RING_MASK;
+
+			CHECK(len % 32 == 0, "chunk of %u bytes is not 32-byte aligned", len);
+			CHECK(len <= RING_CHUNK, "chunk of %u bytes past RING_CHUNK", len);
+			CHECK(chunk == base + at, "chunk at %ld, expected %u", (long)(chunk - base), at);
+			CHECK(at + len <= RING_SIZE, "chunk at %u of %u bytes wraps", at, len);
+			for (i = 0; i < len; i++) {
+				if (chunk[i] != (u8)(consumed + i)) {
+					CHECK(0, "byte %u is %02x, expected %02x", consumed + i, chunk[i], (u8)(consumed + i));
+					break;
+				}
+			}
+			if (len && ((consumed + len) & RING_MASK) == 0) wraps++;
+			consumed += len;
+			playing = len;
+		}
+	}
+
+	CHECK(wraps >= TOTAL / RING_SIZE - 1, "only %u wraps", wraps);
+	printf("stream: %u bytes, %u wraps, %u partial writes\n", consumed, wraps, dropped);
+}
+
+static void testFull() {
+	static u8 block[RING_SIZE + 100];
+	u8 *chunk;
+
+	RingReset();
+	CHECK(RingWrite(block, sizeof(block)) == RING_SIZE, "a full ring takes more than RING_SIZE");
+	CHECK(RingWrite(block, 1) == 0, "a full ring takes more");
+
+	// nothing is released until the chunk handed out has been played
+	CHECK(RingPlay(&chunk) == RING_CHUNK, "first chunk");
+	CHECK(RingWrite(block, 1) == 0, "space reused before the chunk was played");
+	CHECK(RingPlay(&chunk) == RING_CHUNK, "second chunk");
+	CHECK(RingWrite(block, RING_SIZE) == RING_CHUNK, "the played chunk was not released");
+
+	// a tail shorter than 32 bytes waits for more
+	RingReset();
+	CHECK(RingWrite(block, 31) == 31, "short write");
+	CHECK(RingPlay(&chunk) == 0, "played less than 32 bytes");
+	CHECK(RingWrite(block, 1) == 1, "short write");
+	CHECK(RingPlay(&chunk) == 32, "32 bytes not played");
+}
+
+static void fillTo(u32 fill) {
+	static u8 block[RING_SIZE];
+
+	RingReset();
+	RingWrite(block, fill);
+}
+
+static void testRate() {
+	u32 fill, last = 0, rate;
+
+	fillTo(RING_TARGET);
+	CHECK(RingRate(FREQ) == FREQ, "rate %u at the target", RingRate(FREQ));
+	fillTo(0);
+	CHECK(RingRate(FREQ) == FREQ - FREQ / 200, "rate %u when empty", RingRate(FREQ));
+	fillTo(2 * RING_TARGET);
+	CHECK(RingRate(FREQ) == FREQ + FREQ / 200, "rate %u at twice the target", RingRate(FREQ));
+	fillTo(RING_SIZE);
+	CHECK(RingRate(FREQ) == FREQ + FREQ / 200, "rate %u when full", RingRate(FREQ));
+
+	for (fill = 0; fill <= RING_SIZE; fill += 256) {
+		fillTo(fill);
+		rate = RingRate(FREQ);
+		CHECK(rate >= last, "rate drops from %u to %u at fill %u", last, rate, fill);
+		CHECK(rate >= FREQ - FREQ / 200 && rate <= FREQ + FREQ / 200, "rate %u out of range", rate);
+		CHECK((fill < RING_TARGET) == (rate < FREQ) || rate == FREQ, "rate %u on the wrong side at fill %u", rate, fill);
+		last = rate;
+	}
+	printf("rate: %u..%u Hz around %u\n", FREQ - FREQ / 200, FREQ + FREQ / 200, FREQ);
+}
+
+int main() {
+	testStream();
+	testFull();
+	testRate();
+
+	if (failures) {
+		printf("ringTest: %d failures\n", failures);
+		return 1;
+	}
+	printf("ringTest: ok\n");
+	return 0;
+}
@@ -20,6 +20,13 @@
 
 #include "mdec.h"
 
+#ifndef _WIN32
+#define MDEC_ASYNC
+#include <ogc/lwp.h>
+#include <ogc/mutex.h>
+#include <ogc/cond.h>
+#endif
+
 /* memory speed is 1 byte per MDEC_BIAS psx clock
  * That mean (PSXCLK / MDEC_BIAS) B/s
  * MDEC_BIAS = 2.0 => ~16MB/s
@@ -70,9 +77,18 @@ static void printmatrixu8(u8 *m) {
 }
 #endif
 
-static inline void fillcol(int *blk, int val) {
-	blk[0 * DSIZE] = blk[1 * DSIZE] = blk[2 * DSIZE] = blk[3 * DSIZE]
-		= blk[4 * DSIZE] = blk[5 * DSIZE] = blk[6 * DSIZE] = blk[7 * DSIZE] = val;
+// The four luma blocks of a macroblock are decoded into one 16x16 plane
+// (Y1 Y2 on top, Y3 Y4 below) so the colour conversion can walk both the
+// luma and the chroma in scanline order.
+typedef struct {
+	int Cr[DSIZE2];
+	int Cb[DSIZE2];
+	int Y[DSIZE2 * 4];
+} macroblock_t;
+
+static inline void fillcol(int *blk, int stride, int val) {
+	blk[0 * stride] = blk[1 * stride] = blk[2 * stride] = blk[3 * stride]
+		= blk[4 * stride] = blk[5 * stride] = blk[6 * stride] = blk[7 * stride] = val;
 }
 
 static inline void fillrow(int *blk, int val) {
@@ -80,7 +96,9 @@ static inline void fillrow(int *blk, int val) {
 		= blk[4] = blk[5] = blk[6] = blk[7] = val;
 }
 
-void idct(int *block,int used_col) {
+// stride is the distance between two rows of the 8x8 block: DSIZE for
+// the chroma blocks, 2 * DSIZE for a block of the luma plane
+static void idct(int *block, int stride, int used_col) {
 	int tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7;
 	int z5, z10, z11, z12, z13;
 	int *ptr;
@@ -89,7 +107,8 @@ void idct(int *block,int used_col) {
 	// the block has only the DC coefficient
 	if (used_col == -1) { 
 		int v = block[0];
-		for (i = 0; i < DSIZE2; i++) block[i] = v;
+		for (i = 0, ptr = block; i < DSIZE; i++, ptr += stride)
+			fillrow(ptr, v);
 		return;
 	}
 
@@ -98,8 +117,8 @@ void idct(int *block,int used_col) {
 	for (i = 0; i < DSIZE; i++, ptr++) {
 		if ((used_col & (1 << i)) == 0) {
 			// the column is empty or has only the DC coefficient
-			if (ptr[DSIZE * 0]) {
-				fillcol(ptr, ptr[0]);
+			if (ptr[stride * 0]) {
+				fillcol(ptr, stride, ptr[0]);
 				used_col |= (1 << i);
 			}
 			continue;
@@ -107,10 +126,10 @@ void idct(int *block,int used_col) {
 
 		// further optimization could be made by keeping track of 
 		// last_row in rl2blk
-		z10 = ptr[DSIZE * 0] + ptr[DSIZE * 4]; // s04
-		z11 = ptr[DSIZE * 0] - ptr[DSIZE * 4]; // d04
-		z13 = ptr[DSIZE * 2] + ptr[DSIZE * 6]; // s26
-		z12 = MULS(ptr[DSIZE * 2] - ptr[DSIZE * 6], FIX_1_414213562) - z13; 
+		z10 = ptr[stride * 0] + ptr[stride * 4]; // s04
+		z11 = ptr[stride * 0] - ptr[stride * 4]; // d04
+		z13 = ptr[stride * 2] + ptr[stride * 6]; // s26
+		z12 = MULS(ptr[stride * 2] - ptr[stride * 6], FIX_1_414213562) - z13; 
 		//^^^^  d26=d26*2*A4-s26
 
 		tmp0 = z10 + z13; // os07 = s04 + s26
@@ -118,10 +137,10 @@ void idct(int *block,int used_col) {
 		tmp1 = z11 + z12; // os16 = d04 + d26
 		tmp2 = z11 - z12; // os25 = d04 - d26
 
-		z13 = ptr[DSIZE * 3] + ptr[DSIZE * 5]; //s53
-		z10 = ptr[DSIZE * 3] - ptr[DSIZE * 5]; //-d53 
-		z11 = ptr[DSIZE * 1] + ptr[DSIZE * 7]; //s17
-		z12 = ptr[DSIZE * 1] - ptr[DSIZE * 7]; //d17
+		z13 = ptr[stride * 3] + ptr[stride * 5]; //s53
+		z10 = ptr[stride * 3] - ptr[stride * 5]; //-d53 
+		z11 = ptr[stride * 1] + ptr[stride * 7]; //s17
+		z12 = ptr[stride * 1] - ptr[stride * 7]; //d17
 
 		tmp7 = z11 + z13; // od07 = s17 + s53
 
@@ -150,22 +169,28 @@ void idct(int *block,int used_col) {
 		//    tmp5 = MULS(z11 - z13, FIX_1_414213562) - tmp6;
 		// od25 = (s17 - s53)*2*A4 - od16
 
-		ptr[DSIZE * 0] = (tmp0 + tmp7); // os07 + od07
-		ptr[DSIZE * 7] = (tmp0 - tmp7); // os07 - od07
-		ptr[DSIZE * 1] = (tmp1 + tmp6); // os16 + od16
-		ptr[DSIZE * 6] = (tmp1 - tmp6); // os16 - od16
-		ptr[DSIZE * 2] = (tmp2 + tmp5); // os25 + od25
-		ptr[DSIZE * 5] = (tmp2 - tmp5); // os25 - od25
-		ptr[DSIZE * 4] = (tmp3 + tmp4); // os34 + od34
-		ptr[DSIZE * 3] = (tmp3 - tmp4); // os34 - od34
+		ptr[stride * 0] = (tmp0 + tmp7); // os07 + od07
+		ptr[stride * 7] = (tmp0 - tmp7); // os07 - od07
+		ptr[stride * 1] = (tmp1 + tmp6); // os16 + od16
+		ptr[stride * 6] = (tmp1 - tmp6); // os16 - od16
+		ptr[stride * 2] = (tmp2 + tmp5); // os25 + od25
+		ptr[stride * 5] = (tmp2 - tmp5); // os25 - od25
+		ptr[stride * 4] = (tmp3 + tmp4); // os34 + od34
+		ptr[stride * 3] = (tmp3 - tmp4); // os34 - od34
 	}
 
 	ptr = block;
 	if (used_col == 1) {
-		for (i = 0; i < DSIZE; i++)
-			fillrow(block + DSIZE * i, block[DSIZE * i]);    
+		for (i = 0; i < DSIZE; i++, ptr += stride)
+			fillrow(ptr, ptr[0]);    
 	} else {
-		for (i = 0; i < DSIZE; i++, ptr += DSIZE) {
+		for (i = 0; i < DSIZE; i++, ptr += stride) {
+			// a row without AC terms transforms to its DC value
+			if (!(ptr[1] | ptr[2] | ptr[3] | ptr[4] | ptr[5] | ptr[6] | ptr[7])) {
+				fillrow(ptr, ptr[0]);
+				continue;
+			}
+
 			z10 = ptr[0] + ptr[4];
 			z11 = ptr[0] - ptr[4];
 			z13 = ptr[2] + ptr[6];
@@ -263,15 +288,27 @@ static void iqtab_init(int *iqtab, unsigned char *iq_y) {
 
 #define	MDEC_END_OF_DATA	0xfe00
 
-unsigned short *rl2blk(int *blk, unsigned short *mdec_rl) {
-	int i, k, q_scale, rl, used_col;
- 	int *iqtab;
+static unsigned short *rl2blk(macroblock_t *mb, unsigned short *mdec_rl) {
+	int i, k, z, q_scale, rl, used_col;
+	int *blk, *iqtab;
+	int stride, rowmask;
 
-	memset(blk, 0, 6 * DSIZE2 * sizeof(int));
+	memset(mb, 0, sizeof(*mb));
 	iqtab = iq_uv;
 	for (i = 0; i < 6; i++) {
 		// decode blocks (Cr,Cb,Y1,Y2,Y3,Y4)
-		if (i == 2) iqtab = iq_y;
+		switch (i) {
+			case 0: blk = mb->Cr; break;
+			case 1: blk = mb->Cb; break;
+			case 2: blk = mb->Y; iqtab = iq_y; break;
+			case 3: blk = mb->Y + DSIZE; break;
+			case 4: blk = mb->Y + DSIZE2 * 2; break;
+			default: blk = mb->Y + DSIZE2 * 2 + DSIZE; break;
+		}
+		// luma rows are twice as long: row r starts at r * 16, which is
+		// the 8x8 position plus its row bits
+		stride = (i < 2) ? DSIZE : DSIZE * 2;
+		rowmask = (i < 2) ? 0 : 0x38;
 
 		rl = SWAP16(*mdec_rl); mdec_rl++;
 		q_scale = RLE_RUN(rl);
@@ -287,9 +324,10 @@ unsigned short *rl2blk(int *blk, unsigned short *mdec_rl) {
 			}
 
 			// zigzag transformation
-			blk[zscan[k]] = SCALER(RLE_VAL(rl) * iqtab[k] * q_scale, AAN_EXTRA);
+			z = zscan[k];
+			blk[z + (z & rowmask)] = SCALER(RLE_VAL(rl) * iqtab[k] * q_scale, AAN_EXTRA);
 			// keep track of used columns to speed up the idtc
-			used_col |= (zscan[k] > 7) ? 1 << (zscan[k] & 7) : 0;
+			used_col |= (z > 7) ? 1 << (z & 7) : 0;
 		}
 
 		if (k == 0) used_col = -1;
@@ -298,8 +336,7 @@ unsigned short *rl2blk(int *blk, unsigned short *mdec_rl) {
 		// at least one non zero cofficient in the rows 1-7
 		// single coefficients in row 0 are treted specially 
 		// in the idtc function
-		idct(blk, used_col);
-		blk += DSIZE2;
+		idct(blk, stride, used_col);
 	}
 	return mdec_rl;
 }
@@ -318,130 +355,342 @@ unsigned short *rl2blk(int *blk, unsigned short *mdec_rl) {
 #define	SCALE8(c)				SCALER(c, 20) 
 #define SCALE5(c)				SCALER(c, 23)
 
-#define CLAMP5(c)	( ((c) < -16) ? 0 : (((c) > (31 - 16)) ? 31 : ((c) + 16)) )
-#define CLAMP8(c)	( ((c) < -128) ? 0 : (((c) > (255 - 128)) ? 255 : ((c) + 128)) )
+// Clamp a signed component to [0, 2^n - 1] after recentering it. Values
+// are almost always in range, so there is a single unsigned compare on
+// the common path.
+static inline int clamp5(int c) {
+	c += 16;
+	if ((u32)c > 31) c = (~c >> 31) & 31;
+	return c;
+}
 
-#define CLAMP_SCALE8(a)   (CLAMP8(SCALE8(a)))
-#define CLAMP_SCALE5(a)   (CLAMP5(SCALE5(a)))
+static inline int clamp8(int c) {
+	c += 128;
+	if ((u32)c > 255) c = (~c >> 31) & 255;
+	return c;
+}
 
-inline void putlinebw15(u16 *image, int *Yblk) {
-	int i;
-	int A = (mdec.reg0 & MDEC0_STP) ? 0x8000 : 0;
+#define CLAMP_SCALE8(a)   (clamp8(SCALE8(a)))
+#define CLAMP_SCALE5(a)   (clamp5(SCALE5(a)))
 
-	for (i = 0; i < 8; i++, Yblk++) {
-		int Y = *Yblk;
-		// missing rounding
-		image[i] = SWAP16((CLAMP5(Y >> 3) * 0x421) | A);
-	}
+#define PUTRGB15(p, y) { \
+	int Y = MULY(y); \
+	*(p) = MAKERGB15(CLAMP_SCALE5(Y + R), CLAMP_SCALE5(Y + G), CLAMP_SCALE5(Y + B), A); \
 }
 
-inline void putquadrgb15(u16 *image, int *Yblk, int Cr, int Cb) {
-	int Y, R, G, B;
-	int A = (mdec.reg0 & MDEC0_STP) ? 0x8000 : 0;
-	R = MULR(Cr);
-	G = MULG2(Cb, Cr);
-	B = MULB(Cb);
-
-	// added transparency
-	Y = MULY(Yblk[0]);
-	image[0] = MAKERGB15(CLAMP_SCALE5(Y + R), CLAMP_SCALE5(Y + G), CLAMP_SCALE5(Y + B), A);
-	Y = MULY(Yblk[1]);
-	image[1] = MAKERGB15(CLAMP_SCALE5(Y + R), CLAMP_SCALE5(Y + G), CLAMP_SCALE5(Y + B), A);
-	Y = MULY(Yblk[8]);
-	image[16] = MAKERGB15(CLAMP_SCALE5(Y + R), CLAMP_SCALE5(Y + G), CLAMP_SCALE5(Y + B), A);
-	Y = MULY(Yblk[9]);
-	image[17] = MAKERGB15(CLAMP_SCALE5(Y + R), CLAMP_SCALE5(Y + G), CLAMP_SCALE5(Y + B), A);
+#define PUTRGB24(p, y) { \
+	int Y = MULY(y); \
+	(p)[0] = CLAMP_SCALE8(Y + R); \
+	(p)[1] = CLAMP_SCALE8(Y + G); \
+	(p)[2] = CLAMP_SCALE8(Y + B); \
 }
 
-inline void yuv2rgb15(int *blk, unsigned short *image) {
+// set in a format for Config.Mdec (black and white) output
+#define MDEC_FORMAT_BW	1
+
+// Each chroma sample covers a 2x2 quad of the luma plane: the chroma terms
+// are computed once per quad and both luma rows are written in one pass.
+static void yuv2rgb15(macroblock_t *mb, u16 *image, u32 format) {
 	int x, y;
-	int *Yblk = blk + DSIZE2 * 2;
-	int *Crblk = blk;
-	int *Cbblk = blk + DSIZE2;
-
-	if (!Config.Mdec) {
-		for (y = 0; y < 16; y += 2, Crblk += 4, Cbblk += 4, Yblk += 8, image += 24) {
-			if (y == 8) Yblk += DSIZE2;
-			for (x = 0; x < 4; x++, image += 2, Crblk++, Cbblk++, Yblk += 2) {
-				putquadrgb15(image, Yblk, *Crblk, *Cbblk);
-				putquadrgb15(image + 8, Yblk + DSIZE2, *(Crblk + 4), *(Cbblk + 4));
+	int *Yblk = mb->Y;
+	int A = (format & MDEC0_STP) ? 0x8000 : 0;
+
+	if (!(format & MDEC_FORMAT_BW)) {
+		int *Crblk = mb->Cr;
+		int *Cbblk = mb->Cb;
+
+		for (y = 0; y < 16; y += 2, Yblk += 32, image += 32) {
+			for (x = 0; x < 16; x += 2, Crblk++, Cbblk++) {
+				int R = MULR(*Crblk);
+				int G = MULG2(*Cbblk, *Crblk);
+				int B = MULB(*Cbblk);
+
+				PUTRGB15(image + x, Yblk[x]);
+				PUTRGB15(image + x + 1, Yblk[x + 1]);
+				PUTRGB15(image + x + 16, Yblk[x + 16]);
+				PUTRGB15(image + x + 17, Yblk[x + 17]);
 			}
-		} 
+		}
 	} else {
-		for (y = 0; y < 16; y++, Yblk += 8, image += 16) {
-			if (y == 8) Yblk += DSIZE2;
-			putlinebw15(image, Yblk);
-			putlinebw15(image + 8, Yblk + DSIZE2);
+		for (y = 0; y < 16 * 16; y++) {
+			// missing rounding
+			image[y] = SWAP16((clamp5(Yblk[y] >> 3) * 0x421) | A);
 		}
 	}
 }
 
-inline void putlinebw24(u8 * image, int *Yblk) {
-	int i;
-	unsigned char Y;
-	for (i = 0; i < 8 * 3; i += 3, Yblk++) {
-		Y = CLAMP8(*Yblk);
-		image[i + 0] = Y;
-		image[i + 1] = Y;
-		image[i + 2] = Y;
+static void yuv2rgb24(macroblock_t *mb, u8 *image, u32 format) {
+	int x, y;
+	int *Yblk = mb->Y;
+
+	if (!(format & MDEC_FORMAT_BW)) {
+		int *Crblk = mb->Cr;
+		int *Cbblk = mb->Cb;
+
+		for (y = 0; y < 16; y += 2, Yblk += 32, image += 32 * 3) {
+			u8 *p = image;
+
+			for (x = 0; x < 16; x += 2, Crblk++, Cbblk++, p += 2 * 3) {
+				int R = MULR(*Crblk);
+				int G = MULG2(*Cbblk, *Crblk);
+				int B = MULB(*Cbblk);
+				// byte stores may alias the blocks, load the quad first
+				int Y0 = Yblk[x], Y1 = Yblk[x + 1];
+				int Y2 = Yblk[x + 16], Y3 = Yblk[x + 17];
+
+				PUTRGB24(p, Y0);
+				PUTRGB24(p + 3, Y1);
+				PUTRGB24(p + 16 * 3, Y2);
+				PUTRGB24(p + 17 * 3, Y3);
+			}
+		}
+	} else {
+		for (y = 0; y < 16 * 16; y++, image += 3) {
+			u8 Y = clamp8(Yblk[y]);
+			image[0] = Y;
+			image[1] = Y;
+			image[2] = Y;
+		}
 	}
 }
 
-inline void putquadrgb24(u8 * image, int *Yblk, int Cr, int Cb) {
-	int Y, R, G, B;
-
-	R = MULR(Cr);
-	G = MULG2(Cb,Cr);
-	B = MULB(Cb);
-
-	Y = MULY(Yblk[0]);
-	image[0 * 3 + 0] = CLAMP_SCALE8(Y + R);
-	image[0 * 3 + 1] = CLAMP_SCALE8(Y + G);
-	image[0 * 3 + 2] = CLAMP_SCALE8(Y + B);
-	Y = MULY(Yblk[1]);
-	image[1 * 3 + 0] = CLAMP_SCALE8(Y + R);
-	image[1 * 3 + 1] = CLAMP_SCALE8(Y + G);
-	image[1 * 3 + 2] = CLAMP_SCALE8(Y + B);
-	Y = MULY(Yblk[8]);
-	image[16 * 3 + 0] = CLAMP_SCALE8(Y + R);
-	image[16 * 3 + 1] = CLAMP_SCALE8(Y + G);
-	image[16 * 3 + 2] = CLAMP_SCALE8(Y + B);
-	Y = MULY(Yblk[9]);
-	image[17 * 3 + 0] = CLAMP_SCALE8(Y + R);
-	image[17 * 3 + 1] = CLAMP_SCALE8(Y + G);
-	image[17 * 3 + 2] = CLAMP_SCALE8(Y + B);
+#ifdef MDEC_ASYNC
+/* The run-length stream queued by dma0 is copied out of PSX RAM and a
+ * worker thread decodes the copy into a ring of finished macroblocks; dma1
+ * only copies them out (waiting if the worker is behind). Decoding from the
+ * copy keeps the result independent of how far the worker got when the
+ * game reuses the input buffer. The worker runs below the emulation thread
+ * so on a single core it fills the time the main thread spends blocked;
+ * each side only signals the other when it is actually waiting.
+ */
+#define MDEC_QUEUE_BLOCKS	64
+#define MDEC_STACK_SIZE		(16 * 1024)
+#define MDEC_PRIORITY		50
+
+static struct {
+	lwp_t thread;
+	mutex_t lock;
+	cond_t cond;
+	boolean job;		// a stream is queued
+	boolean done;		// the worker reached the end of it
+	boolean cancel;
+	boolean quit;
+	boolean want_block;	// dma1 waits for the worker
+	boolean want_room;	// the worker waits for dma1
+	u32 format;
+	u16 *in;			// copy of the stream, starting at mdec.rl
+	u32 in_size;		// halfwords allocated
+	u16 *in_psx;		// where the copy came from
+	u16 *rl;			// worker input position in the copy
+	u16 *rl_end;
+	u32 head, tail;		// produced / consumed macroblocks
+	u16 *rl_next[MDEC_QUEUE_BLOCKS];	// input position after each macroblock
+	u8 out[MDEC_QUEUE_BLOCKS][16*16*3];
+} mdec_queue;
+
+static char mdec_stack[MDEC_STACK_SIZE];
+static boolean mdec_thread_running = FALSE;
+#endif
+
+/* output format of a macroblock: dma1 can only take queued blocks
+ * decoded with the current one */
+static u32 mdec_format(void) {
+	return (mdec.reg0 & (MDEC0_RGB24 | MDEC0_STP)) | (Config.Mdec ? MDEC_FORMAT_BW : 0);
 }
 
-static void yuv2rgb24(int *blk, u8 *image) {
-	int x, y;
-	int *Yblk = blk + DSIZE2 * 2;
-	int *Crblk = blk;
-	int *Cbblk = blk + DSIZE2;
-
-	if (!Config.Mdec) {
-		for (y = 0; y < 16; y += 2, Crblk += 4, Cbblk += 4, Yblk += 8, image += 8 * 3 * 3) {
-			if (y == 8) Yblk += DSIZE2;
-			for (x = 0; x < 4; x++, image += 6, Crblk++, Cbblk++, Yblk += 2) {
-				putquadrgb24(image, Yblk, *Crblk, *Cbblk);
-				putquadrgb24(image + 8 * 3, Yblk + DSIZE2, *(Crblk + 4), *(Cbblk + 4));
-			}
+static u16 *decode_block(u8 *image, u16 *rl, u32 format) {
+	macroblock_t mb;
+
+	rl = rl2blk(&mb, rl);
+	// MDEC0_RGB24 clear selects 24 bits output
+	if (format & MDEC0_RGB24)
+		yuv2rgb15(&mb, (u16 *)image, format);
+	else
+		yuv2rgb24(&mb, image, format);
+	return rl;
+}
+
+#ifdef MDEC_ASYNC
+static void *mdec_thread(void *arg) {
+	u16 *rl;
+	u32 slot;
+
+	LWP_MutexLock(mdec_queue.lock);
+	while (!mdec_queue.quit) {
+		if (!mdec_queue.job || mdec_queue.done) {
+			LWP_CondWait(mdec_queue.cond, mdec_queue.lock);
+			continue;
 		}
-	} else {
-		for (y = 0; y < 16; y++, Yblk += 8, image += 16 * 3) {
-			if (y == 8) Yblk += DSIZE2;
-			putlinebw24(image, Yblk);
-			putlinebw24(image + 8 * 3, Yblk + DSIZE2);
+		if (mdec_queue.cancel || mdec_queue.rl >= mdec_queue.rl_end ||
+			SWAP16(*mdec_queue.rl) == MDEC_END_OF_DATA) {
+			mdec_queue.done = TRUE;
+			LWP_CondBroadcast(mdec_queue.cond);
+			continue;
+		}
+		if (mdec_queue.head - mdec_queue.tail >= MDEC_QUEUE_BLOCKS) {
+			mdec_queue.want_room = TRUE;
+			LWP_CondWait(mdec_queue.cond, mdec_queue.lock);
+			continue;
+		}
+
+		slot = mdec_queue.head % MDEC_QUEUE_BLOCKS;
+		LWP_MutexUnlock(mdec_queue.lock);
+		rl = decode_block(mdec_queue.out[slot], mdec_queue.rl, mdec_queue.format);
+		LWP_MutexLock(mdec_queue.lock);
+
+		mdec_queue.rl = rl;
+		mdec_queue.rl_next[slot] = rl;
+		mdec_queue.head++;
+		if (mdec_queue.want_block) {
+			mdec_queue.want_block = FALSE;
+			LWP_CondBroadcast(mdec_queue.cond);
 		}
 	}
+	LWP_MutexUnlock(mdec_queue.lock);
+
+	return NULL;
+}
+
+// drop the queued stream, mdec.rl still points after the last block dma1 took
+static void mdec_async_stop(void) {
+	if (!mdec_thread_running) return;
+
+	LWP_MutexLock(mdec_queue.lock);
+	if (mdec_queue.job) {
+		mdec_queue.cancel = TRUE;
+		LWP_CondBroadcast(mdec_queue.cond);
+		while (!mdec_queue.done)
+			LWP_CondWait(mdec_queue.cond, mdec_queue.lock);
+	}
+	mdec_queue.job = FALSE;
+	mdec_queue.done = FALSE;
+	mdec_queue.cancel = FALSE;
+	mdec_queue.want_block = FALSE;
+	mdec_queue.want_room = FALSE;
+	mdec_queue.head = mdec_queue.tail = 0;
+	LWP_MutexUnlock(mdec_queue.lock);
+}
+
+// queue the stream from mdec.rl, FALSE to leave it to decode_block when
+// it isn't in RAM or there is no memory for the copy
+static boolean mdec_async_start(void) {
+	u32 ram, len;
+
+	if (!mdec_thread_running) {
+		LWP_MutexInit(&mdec_queue.lock, FALSE);
+		LWP_CondInit(&mdec_queue.cond);
+		if (LWP_CreateThread(&mdec_queue.thread, mdec_thread, NULL,
+							 mdec_stack, MDEC_STACK_SIZE, MDEC_PRIORITY) < 0) {
+			LWP_CondDestroy(mdec_queue.cond);
+			LWP_MutexDestroy(mdec_queue.lock);
+			return FALSE;
+		}
+		mdec_thread_running = TRUE;
+	}
+
+	mdec_async_stop();
+
+	ram = (u8 *)mdec.rl - (u8 *)psxCore.psxM;
+	if ((u8 *)mdec.rl < (u8 *)psxCore.psxM || ram >= 0x200000 || mdec.rl_end <= mdec.rl)
+		return FALSE;
+	len = mdec.rl_end - mdec.rl;
+	if (len > (0x200000 - ram) / 2) len = (0x200000 - ram) / 2;
+
+	if (len > mdec_queue.in_size) {
+		u16 *in = (u16 *)realloc(mdec_queue.in, len * 2);
+		if (in == NULL) return FALSE;
+		mdec_queue.in = in;
+		mdec_queue.in_size = len;
+	}
+	memcpy(mdec_queue.in, mdec.rl, len * 2);
+
+	LWP_MutexLock(mdec_queue.lock);
+	mdec_queue.in_psx = mdec.rl;
+	mdec_queue.rl = mdec_queue.in;
+	mdec_queue.rl_end = mdec_queue.in + len;
+	mdec_queue.format = mdec_format();
+	mdec_queue.job = TRUE;
+	LWP_CondBroadcast(mdec_queue.cond);
+	LWP_MutexUnlock(mdec_queue.lock);
+	return TRUE;
+}
+
+static boolean mdec_async_get(u8 *image, int size) {
+	boolean ret = FALSE;
+	u32 slot;
+
+	LWP_MutexLock(mdec_queue.lock);
+	while (mdec_queue.head == mdec_queue.tail && !mdec_queue.done) {
+		mdec_queue.want_block = TRUE;
+		LWP_CondWait(mdec_queue.cond, mdec_queue.lock);
+	}
+
+	if (mdec_queue.head != mdec_queue.tail) {
+		slot = mdec_queue.tail % MDEC_QUEUE_BLOCKS;
+		memcpy(image, mdec_queue.out[slot], size);
+		mdec.rl = mdec_queue.in_psx + (mdec_queue.rl_next[slot] - mdec_queue.in);
+		mdec_queue.tail++;
+		if (mdec_queue.want_room) {
+			mdec_queue.want_room = FALSE;
+			LWP_CondBroadcast(mdec_queue.cond);
+		}
+		ret = TRUE;
+	}
+	LWP_MutexUnlock(mdec_queue.lock);
+
+	return ret;
+}
+#else
+#define mdec_async_start()	FALSE
+#define mdec_async_stop()
+#endif
+
+// next macroblock for dma1, from the worker when it has it
+static void mdec_next_block(u8 *image, int size) {
+#ifdef MDEC_ASYNC
+	// restart the worker when the output format changed, or after a reset
+	// or a state load dropped the queue
+	if ((mdec_thread_running && mdec_queue.job && mdec_queue.format == mdec_format()) ||
+		mdec_async_start()) {
+		if (mdec_async_get(image, size))
+			return;
+	}
+#endif
+
+	// past the end of the stream, or no worker: decode it here
+	mdec.rl = decode_block(image, mdec.rl, mdec_format());
 }
 
 void mdecInit(void) {
+	mdec_async_stop();
 	memset(&mdec, 0, sizeof(mdec));
 	memset(iq_y, 0, sizeof(iq_y));
 	memset(iq_uv, 0, sizeof(iq_uv));
 	mdec.rl = (u16 *)&psxCore.psxM[0x100000];
 }
 
+// stop the worker and free the stream copy, the next dma1 starts over
+void mdecShutdown(void) {
+#ifdef MDEC_ASYNC
+	if (!mdec_thread_running) return;
+
+	mdec_async_stop();
+	LWP_MutexLock(mdec_queue.lock);
+	mdec_queue.quit = TRUE;
+	LWP_CondBroadcast(mdec_queue.cond);
+	LWP_MutexUnlock(mdec_queue.lock);
+	LWP_JoinThread(mdec_queue.thread, NULL);
+
+	LWP_CondDestroy(mdec_queue.cond);
+	LWP_MutexDestroy(mdec_queue.lock);
+	free(mdec_queue.in);
+	mdec_queue.in = NULL;
+	mdec_queue.in_size = 0;
+	mdec_queue.quit = FALSE;
+	mdec_thread_running = FALSE;
+#endif
+}
+
 // command register
 void mdecWrite0(u32 data) {
 	mdec.reg0 = data;
@@ -454,6 +703,7 @@ u32 mdecRead0(void) {
 // status register
 void mdecWrite1(u32 data) {
 	if (data & MDEC1_RESET) { // mdec reset
+		mdec_async_stop();
 		mdec.reg0 = 0;
 		mdec.reg1 = 0;
 		mdec.pending_dma1.adr = 0;
@@ -474,6 +724,9 @@ void psxDma0(u32 adr, u32 bcr, u32 chcr) {
 		return;
 	}
 
+	/* a new command replaces the queued stream and may change the tables */
+	mdec_async_stop();
+
 	/* mdec is STP till dma0 is released */
 	mdec.reg1 |= MDEC1_STP;
 
@@ -493,6 +746,9 @@ void psxDma0(u32 adr, u32 bcr, u32 chcr) {
 				return;
 			}
 
+			/* start decoding ahead of dma1 */
+			mdec_async_start();
+
 			/* process the pending dma1 */
 			if(mdec.pending_dma1.adr){
 				psxDma1(mdec.pending_dma1.adr, mdec.pending_dma1.bcr, mdec.pending_dma1.chcr);
@@ -539,7 +795,6 @@ void mdec0Interrupt()
 #define SIZE_OF_16B_BLOCK (16*16*2)
 
 void psxDma1(u32 adr, u32 bcr, u32 chcr) {
-	int blk[DSIZE2 * 6];
 	u8 * image;
 	int size;
 	int dmacnt;
@@ -578,15 +833,13 @@ void psxDma1(u32 adr, u32 bcr, u32 chcr) {
 		}
 
 		while(size >= SIZE_OF_16B_BLOCK) {
-			mdec.rl = rl2blk(blk, mdec.rl);
-			yuv2rgb15(blk, (u16 *)image);
+			mdec_next_block(image, SIZE_OF_16B_BLOCK);
 			image += SIZE_OF_16B_BLOCK;
 			size -= SIZE_OF_16B_BLOCK;
 		}
 
 		if(size != 0) {
-			mdec.rl = rl2blk(blk, mdec.rl);
-			yuv2rgb15(blk, (u16 *)mdec.block_buffer);
+			mdec_next_block(mdec.block_buffer, SIZE_OF_16B_BLOCK);
 			memcpy(image, mdec.block_buffer, size);
 			mdec.block_buffer_pos = mdec.block_buffer + size;
 		}
@@ -607,15 +860,13 @@ void psxDma1(u32 adr, u32 bcr, u32 chcr) {
 		}
 
 		while(size >= SIZE_OF_24B_BLOCK) {
-			mdec.rl = rl2blk(blk, mdec.rl);
-			yuv2rgb24(blk, image);
+			mdec_next_block(image, SIZE_OF_24B_BLOCK);
 			image += SIZE_OF_24B_BLOCK;
 			size -= SIZE_OF_24B_BLOCK;
 		}
 
 		if(size != 0) {
-			mdec.rl = rl2blk(blk, mdec.rl);
-			yuv2rgb24(blk, mdec.block_buffer);
+			mdec_next_block(mdec.block_buffer, SIZE_OF_24B_BLOCK);
 			memcpy(image, mdec.block_buffer, size);
 			mdec.block_buffer_pos = mdec.block_buffer + size;
 		}
@@ -669,7 +920,11 @@ void mdec1Interrupt() {
 	return;
 }
 
-int mdecFreeze(gzFile f, int Mode) {
+int mdecFreeze(FreezeBuf *f, int Mode) {
+	// the queue is rebuilt from mdec.rl by the next dma1
+	if (Mode != 2)
+		mdec_async_stop();
+
 	gzfreeze(&mdec, sizeof(mdec));
 	gzfreeze(iq_y, sizeof(iq_y));
 	gzfreeze(iq_uv, sizeof(iq_uv));
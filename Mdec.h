@@ -30,6 +30,7 @@ extern "C" {
 #include "psxdma.h"
 
 void mdecInit();
+void mdecShutdown();
 void mdecWrite0(u32 data);
 void mdecWrite1(u32 data);
 u32 mdecRead0();
@@ -37,7 +38,7 @@ u32 mdecRead1();
 void psxDma0(u32 madr, u32 bcr, u32 chcr);
 void psxDma1(u32 madr, u32 bcr, u32 chcr);
 void mdec1Interrupt();
-int mdecFreeze(gzFile f, int Mode);
+int mdecFreeze(FreezeBuf *f, int Mode);
 
 #ifdef __cplusplus
 }
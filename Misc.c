@@ -25,8 +25,10 @@
 #include "cdrom.h"
 #include "mdec.h"
 #include "ppf.h"
+#include "cdriso.h"
 #include "Gamecube/wiiSXconfig.h"
 #include "Gamecube/fileBrowser/fileBrowser-libfat.h"
+#include <stddef.h>
 
 char CdromId[10] = "";
 char CdromLabel[33] = "";
@@ -53,30 +55,6 @@ struct iso_directory_record {
 	char name			[1];
 };
 
-void mmssdd( char *b, char *p )
-{
-	int m, s, d;
-#if defined(HW_RVL) || defined(HW_DOL) || defined(BIG_ENDIAN)
-	int block = (b[0] & 0xff) | ((b[1] & 0xff) << 8) | ((b[2] & 0xff) << 16) | (b[3] << 24);
-#else
-	int block = *((int*)b);
-#endif
-
-	block += 150;
-	m = block / 4500;			// minutes
-	block = block - m * 4500;	// minutes rest
-	s = block / 75;				// seconds
-	d = block - s * 75;			// seconds rest
-
-	m = ((m / 10) << 4) | m % 10;
-	s = ((s / 10) << 4) | s % 10;
-	d = ((d / 10) << 4) | d % 10;	
-
-	p[0] = m;
-	p[1] = s;
-	p[2] = d;
-}
-
 #define incTime() \
 	time[0] = btoi(time[0]); time[1] = btoi(time[1]); time[2] = btoi(time[2]); \
 	time[2]++; \
@@ -95,57 +73,357 @@ void mmssdd( char *b, char *p )
 	buf = CDR_getBuffer(); \
 	if (buf == NULL) return -1; else CheckPPFCache(buf, time[0], time[1], time[2]);
 
-#define READDIR(_dir) \
-	READTRACK(); \
-	memcpy(_dir, buf + 12, 2048); \
- \
-	incTime(); \
-	READTRACK(); \
-	memcpy(_dir + 2048, buf + 12, 2048);
-
-int GetCdromFile(u8 *mdir, u8 *time, char *filename) {
-	struct iso_directory_record *dir;
-	char ddir[4096];
-	u8 *buf;
+/*
+* ISO9660 index.
+*
+* The disc's whole directory tree is parsed once, on the first lookup, into
+* a table of paths hashed for constant time lookups. It's saved next to the
+* image as <image>.idx, tagged with a hash of the primary volume descriptor,
+* so later boots of the same disc read no directory sectors at all.
+*/
+
+#define CDINDEX_MAGIC		"PSXIDX01"
+#define CDINDEX_PATH		256
+#define CDINDEX_MAX			32768	// entries, also stops directory loops
+#define CDINDEX_DIR_SECTORS	64		// largest directory read
+
+typedef struct {
+	u32 hash;
+	u32 lba;
+	u32 size;
+	u32 name;			// offset in cdIndexNames
+	u32 dir;
+} CdromIndexEntry;
+
+static CdromIndexEntry *cdIndex = NULL;
+static int cdIndexCount = 0, cdIndexMax = 0;
+static char *cdIndexNames = NULL;
+static u32 cdIndexNamesSize = 0, cdIndexNamesMax = 0;
+static s32 *cdIndexSlots = NULL;
+static u32 cdIndexMask = 0;
+static boolean cdIndexReady = FALSE;
+
+static u32 CdromIndexHash(const u8 *p, int len) {
+	u32 h = 2166136261u;
+
+	while (len--) h = (h ^ *p++) * 16777619u;
+	return h;
+}
+
+static u32 IsoGet32(const char *b) {
+	return (b[0] & 0xff) | ((b[1] & 0xff) << 8) | ((b[2] & 0xff) << 16) | ((u32)(b[3] & 0xff) << 24);
+}
+
+static void IsoPut32(u8 *b, u32 v) {
+	b[0] = v; b[1] = v >> 8; b[2] = v >> 16; b[3] = v >> 24;
+}
+
+// lba to bcd msf
+static void CdromTime(u32 lba, u8 *time) {
+	lba += 150;
+	time[0] = itob(lba / 4500);
+	time[1] = itob((lba / 75) % 60);
+	time[2] = itob(lba % 75);
+}
+
+// Turns a path into its key: upper case, backslashes, no device, leading
+// separator or version number
+static void CdromIndexKey(char *key, const char *path) {
+	int i = 0;
+
+	if (!strnicmp(path, "cdrom:", 6)) path += 6;
+	while (*path == '\\' || *path == '/') path++;
+	while (*path > ' ' && *path != ';' && i < CDINDEX_PATH - 1) {
+		key[i++] = *path == '/' ? '\\' : toupper((unsigned char)*path);
+		path++;
+	}
+	if (i && key[i - 1] == '.') i--;	// "NAME.;1"
+	key[i] = '\0';
+}
+
+static void CdromIndexReset() {
+	free(cdIndex);
+	free(cdIndexNames);
+	free(cdIndexSlots);
+	cdIndex = NULL;
+	cdIndexNames = NULL;
+	cdIndexSlots = NULL;
+	cdIndexCount = cdIndexMax = 0;
+	cdIndexNamesSize = cdIndexNamesMax = 0;
+	cdIndexReady = FALSE;
+}
+
+static int CdromIndexAdd(const char *key, u32 lba, u32 size, u32 dir) {
+	u32 len = strlen(key) + 1;
+	CdromIndexEntry *e;
+
+	if (cdIndexCount >= CDINDEX_MAX) return -1;
+	if (cdIndexCount == cdIndexMax) {
+		cdIndexMax = cdIndexMax ? cdIndexMax * 2 : 256;
+		e = (CdromIndexEntry *)realloc(cdIndex, cdIndexMax * sizeof(CdromIndexEntry));
+		if (e == NULL) return -1;
+		cdIndex = e;
+	}
+	if (cdIndexNamesSize + len > cdIndexNamesMax) {
+		char *names;
+
+		cdIndexNamesMax = cdIndexNamesMax ? cdIndexNamesMax * 2 : 8192;
+		if (cdIndexNamesMax < cdIndexNamesSize + len) cdIndexNamesMax = cdIndexNamesSize + len;
+		names = (char *)realloc(cdIndexNames, cdIndexNamesMax);
+		if (names == NULL) return -1;
+		cdIndexNames = names;
+	}
+
+	e = &cdIndex[cdIndexCount++];
+	e->hash = CdromIndexHash((const u8 *)key, len - 1);
+	e->lba = lba;
+	e->size = size;
+	e->name = cdIndexNamesSize;
+	e->dir = dir;
+	memcpy(cdIndexNames + cdIndexNamesSize, key, len);
+	cdIndexNamesSize += len;
+	return 0;
+}
+
+static u8 *CdromIndexRead(u32 lba) {
+	u8 time[4], *buf;
+
+	CdromTime(lba, time);
+	if (CDR_readTrack(time) == -1) return NULL;
+	buf = CDR_getBuffer();
+	if (buf != NULL) CheckPPFCache(buf, time[0], time[1], time[2]);
+	return buf;
+}
+
+// Walks the tree breadth first, the entries found so far being the queue
+static int CdromIndexBuild(const u8 *pvd) {
+	const struct iso_directory_record *root = (const struct iso_directory_record *)(pvd + 156);
 	int i;
 
-	// only try to scan if a filename is given
-	if (!strlen((char*)filename)) return -1;
+	if (CdromIndexAdd("", IsoGet32(root->extent), IsoGet32(root->size), 1) < 0) return -1;
+
+	for (i = 0; i < cdIndexCount; i++) {
+		char parent[CDINDEX_PATH], path[CDINDEX_PATH * 2], key[CDINDEX_PATH];
+		u32 lba = cdIndex[i].lba, sectors, s;
+
+		if (!cdIndex[i].dir) continue;
+		strcpy(parent, cdIndexNames + cdIndex[i].name);
+		sectors = (cdIndex[i].size + 2047) / 2048;
+		if (sectors > CDINDEX_DIR_SECTORS) sectors = CDINDEX_DIR_SECTORS;
+
+		for (s = 0; s < sectors; s++) {
+			u8 *buf = CdromIndexRead(lba + s);
+			int off = 0;
+
+			if (buf == NULL) return -1;
+			buf += 12;
+
+			// Records never cross a sector, a zero length pads to the next one
+			while (off < 2048 - 33) {
+				struct iso_directory_record *dir = (struct iso_directory_record *)&buf[off];
+				int len = dir->length[0] & 0xff, nlen = dir->name_len[0];
+
+				if (len < 33 || off + len > 2048 || 33 + nlen > len) break;
+				off += len;
+
+				if (nlen == 1 && (dir->name[0] == 0 || dir->name[0] == 1)) continue;	// . and ..
+				snprintf(path, sizeof(path), "%s%s%.*s", parent, parent[0] ? "\\" : "", nlen, dir->name);
+				CdromIndexKey(key, path);
+				if (strlen(path) >= CDINDEX_PATH - 1) continue;
+				if (CdromIndexAdd(key, IsoGet32(dir->extent), IsoGet32(dir->size), (dir->flags[0] & 0x2) != 0) < 0)
+					return -1;
+			}
+		}
+	}
+	return 0;
+}
+
+static int CdromIndexHashAll() {
+	u32 n = 64;
+	int i;
+
+	while (n < (u32)cdIndexCount * 2) n <<= 1;
+	cdIndexSlots = (s32 *)malloc(n * sizeof(s32));
+	if (cdIndexSlots == NULL) return -1;
+	memset(cdIndexSlots, 0xff, n * sizeof(s32));
+	cdIndexMask = n - 1;
+
+	for (i = 0; i < cdIndexCount; i++) {
+		u32 slot = cdIndex[i].hash & cdIndexMask;
+
+		while (cdIndexSlots[slot] != -1) slot = (slot + 1) & cdIndexMask;
+		cdIndexSlots[slot] = i;
+	}
+	return 0;
+}
+
+static void CdromIndexSave(const char *file, u32 disc) {
+	FILE *f = fopen(file, "wb");
+	u8 b[20];
+	int i;
+
+	if (f == NULL) return;
+
+	memcpy(b, CDINDEX_MAGIC, 8);
+	IsoPut32(b + 8, disc);
+	IsoPut32(b + 12, cdIndexCount);
+	IsoPut32(b + 16, cdIndexNamesSize);
+	fwrite(b, 1, 20, f);
+	for (i = 0; i < cdIndexCount; i++) {
+		IsoPut32(b, cdIndex[i].lba);
+		IsoPut32(b + 4, cdIndex[i].size);
+		IsoPut32(b + 8, cdIndex[i].name);
+		IsoPut32(b + 12, cdIndex[i].dir);
+		fwrite(b, 1, 16, f);
+	}
+	fwrite(cdIndexNames, 1, cdIndexNamesSize, f);
+	fclose(f);
+}
+
+static int CdromIndexLoad(const char *file, u32 disc) {
+	FILE *f = fopen(file, "rb");
+	u32 count, namesSize, i;
+	CdromIndexEntry *entries;
+	u8 b[20];
+
+	if (f == NULL) return -1;
+	if (fread(b, 1, 20, f) != 20 || memcmp(b, CDINDEX_MAGIC, 8) || IsoGet32((char *)b + 8) != disc) {
+		fclose(f);
+		return -1;
+	}
+	count = IsoGet32((char *)b + 12);
+	namesSize = IsoGet32((char *)b + 16);
+	if (count == 0 || count > CDINDEX_MAX || namesSize > count * CDINDEX_PATH) {
+		fclose(f);
+		return -1;
+	}
+
+	entries = (CdromIndexEntry *)malloc(count * sizeof(CdromIndexEntry));
+	cdIndexNames = (char *)malloc(namesSize + 1);
+	cdIndex = entries;
+	if (entries == NULL || cdIndexNames == NULL) goto fail;
+
+	for (i = 0; i < count; i++) {
+		if (fread(b, 1, 16, f) != 16) goto fail;
+		entries[i].lba = IsoGet32((char *)b);
+		entries[i].size = IsoGet32((char *)b + 4);
+		entries[i].name = IsoGet32((char *)b + 8);
+		entries[i].dir = IsoGet32((char *)b + 12);
+		if (entries[i].name >= namesSize) goto fail;
+	}
+	if (fread(cdIndexNames, 1, namesSize, f) != namesSize) goto fail;
+	cdIndexNames[namesSize] = '\0';
+	fclose(f);
+
+	for (i = 0; i < count; i++)
+		entries[i].hash = CdromIndexHash((const u8 *)cdIndexNames + entries[i].name, strlen(cdIndexNames + entries[i].name));
+	cdIndexCount = cdIndexMax = count;
+	cdIndexNamesSize = cdIndexNamesMax = namesSize;
+	return 0;
+
+fail:
+	fclose(f);
+	CdromIndexReset();
+	return -1;
+}
 
-	i = 0;
-	while (i < 4096) {
-		dir = (struct iso_directory_record*) &mdir[i];
-		if (dir->length[0] == 0) {
+static int CdromIndexOpen() {
+	char file[MAXPATHLEN];
+	const char *iso = GetIsoFile();
+	u8 pvd[2048], *buf;
+	u32 disc;
+
+	CdromIndexReset();
+
+	buf = CdromIndexRead(16);
+	if (buf == NULL) return -1;
+	memcpy(pvd, buf + 12, 2048);
+	if (memcmp(pvd + 1, "CD001", 5)) return -1;
+	disc = CdromIndexHash(pvd, 2048);
+
+	// Only images have somewhere to keep the index
+	file[0] = '\0';
+	if (cdrIsoActive() && iso != NULL && iso[0] != '\0')
+		snprintf(file, sizeof(file), "%s.idx", iso);
+
+	if (file[0] == '\0' || CdromIndexLoad(file, disc) < 0) {
+		if (CdromIndexBuild(pvd) < 0) {
+			CdromIndexReset();
 			return -1;
 		}
-		i += dir->length[0];
+		if (file[0] != '\0') CdromIndexSave(file, disc);
+	}
 
-		if (dir->flags[0] & 0x2) { // it's a dir
-			if (!strnicmp((char *)&dir->name[0], (char*)filename, dir->name_len[0])) {
-				if (filename[dir->name_len[0]] != '\\') continue;
+	if (CdromIndexHashAll() < 0) {
+		CdromIndexReset();
+		return -1;
+	}
+	cdIndexReady = TRUE;
+	return 0;
+}
 
-				filename += dir->name_len[0] + 1;
+// Finds a file on the disc, by a path with or without the "cdrom:" device
+// and version number
+int CdromIndexFind(const char *path, u32 *lba, u32 *size) {
+	char key[CDINDEX_PATH];
+	u32 slot;
 
-				mmssdd(dir->extent, (char *)time);
-				READDIR(ddir);
-				i = 0;
-				mdir = (u8*)ddir;
-			}
-		} else {
-			if (!strnicmp((char *)&dir->name[0], (char*)filename, strlen(filename))) {
-				mmssdd(dir->extent, (char *)time);
-				break;
-			}
+	if (!cdIndexReady && CdromIndexOpen() < 0) return -1;
+
+	CdromIndexKey(key, path);
+	slot = CdromIndexHash((const u8 *)key, strlen(key)) & cdIndexMask;
+	while (cdIndexSlots[slot] != -1) {
+		CdromIndexEntry *e = &cdIndex[cdIndexSlots[slot]];
+
+		if (!e->dir && !strcmp(cdIndexNames + e->name, key)) {
+			*lba = e->lba;
+			*size = e->size;
+			return 0;
 		}
+		slot = (slot + 1) & cdIndexMask;
+	}
+	return -1;
+}
+
+// Reads part of a file on the disc straight into RAM, lba being the file's
+// first sector
+int LoadCdromData(u32 lba, u32 offset, u32 addr, u32 len) {
+	u8 time[4], *buf;
+
+	while (len) {
+		u32 within = offset % 2048, n = 2048 - within;
+		u32 ram = addr & 0x1fffff;
+
+		if (n > len) n = len;
+		// a copy never runs past the end of RAM, the rest wraps to its start
+		if (n > 0x200000 - ram) n = 0x200000 - ram;
+		CdromTime(lba + offset / 2048, time);
+		READTRACK();
+		// only RAM (and its mirrors) can be a destination
+		if ((addr & 0x1fffffff) < 0x800000) memcpy(&psxCore.psxM[ram], buf + 12 + within, n);
+
+		offset += n;
+		addr += n;
+		len -= n;
 	}
 	return 0;
 }
 
+// Points time at the first sector of a file
+static int GetCdromFile(u8 *time, const char *filename) {
+	u32 lba, size;
+
+	// only try to scan if a filename is given
+	if (!strlen(filename)) return -1;
+
+	if (CdromIndexFind(filename, &lba, &size) == -1) return -1;
+	CdromTime(lba, time);
+	return 0;
+}
+
 int LoadCdrom() {
 	EXE_HEADER tmpHead;
-	struct iso_directory_record *dir;
 	u8 time[4],*buf;
-	u8 mdir[4096];
 	char exename[256];
 
 	if (!Config.HLE) {
@@ -153,21 +431,10 @@ int LoadCdrom() {
 		return 0;
 	}
 
-	time[0] = itob(0); time[1] = itob(2); time[2] = itob(0x10);
-
-	READTRACK();
-
-	// skip head and sub, and go to the root directory record
-	dir = (struct iso_directory_record*) &buf[12+156]; 
-
-	mmssdd(dir->extent, (char*)time);
-
-	READDIR(mdir);
-
 	// Load SYSTEM.CNF and scan for the main executable
-	if (GetCdromFile(mdir, time, "SYSTEM.CNF;1") == -1) {
+	if (GetCdromFile(time, "SYSTEM.CNF;1") == -1) {
 		// if SYSTEM.CNF is missing, start an existing PSX.EXE
-		if (GetCdromFile(mdir, time, "PSX.EXE;1") == -1) return -1;
+		if (GetCdromFile(time, "PSX.EXE;1") == -1) return -1;
 
 		READTRACK();
 	}
@@ -176,9 +443,9 @@ int LoadCdrom() {
 		READTRACK();
 
 		sscanf((char *)buf + 12, "BOOT = cdrom:\\%256s", exename);
-		if (GetCdromFile(mdir, time, exename) == -1) {
+		if (GetCdromFile(time, exename) == -1) {
 			sscanf((char *)buf + 12, "BOOT = cdrom:%256s", exename);
-			if (GetCdromFile(mdir, time, exename) == -1) {
+			if (GetCdromFile(time, exename) == -1) {
 				char *ptr = strstr((char*)buf + 12, "cdrom:");
 				if (ptr != NULL) {
 					ptr += 6;
@@ -188,7 +455,7 @@ int LoadCdrom() {
 					ptr = exename;
 					while (*ptr != '\0' && *ptr != '\r' && *ptr != '\n') ptr++;
 					*ptr = '\0';
-					if (GetCdromFile(mdir, time, exename) == -1)
+					if (GetCdromFile(time, exename) == -1)
 						return -1;
 				} else
 					return -1;
@@ -226,26 +493,10 @@ int LoadCdrom() {
 }
 
 int LoadCdromFile(const char *filename, EXE_HEADER *head) {
-	struct iso_directory_record *dir;
 	u8 time[4],*buf;
-	u8 mdir[4096];
-	char exename[256];
 	u32 size, addr;
 
-	sscanf(filename, "cdrom:\\%256s", exename);
-
-	time[0] = itob(0); time[1] = itob(2); time[2] = itob(0x10);
-
-	READTRACK();
-
-	// skip head and sub, and go to the root directory record
-	dir = (struct iso_directory_record *)&buf[12 + 156]; 
-
-	mmssdd(dir->extent, (char*)time);
-
-	READDIR(mdir);
-
-	if (GetCdromFile(mdir, time, exename) == -1) return -1;
+	if (GetCdromFile(time, filename) == -1) return -1;
 
 	READTRACK();
 
@@ -267,13 +518,12 @@ int LoadCdromFile(const char *filename, EXE_HEADER *head) {
 }
 
 int CheckCdrom() {
-	struct iso_directory_record *dir;
 	unsigned char time[4], *buf;
-	unsigned char mdir[4096];
 	char exename[256];
 	int i, c;
 
 	FreePPFCache();
+	CdromIndexReset();
 
 	time[0] = itob(0);
 	time[1] = itob(2);
@@ -289,20 +539,13 @@ int CheckCdrom() {
 		if(CdromLabel[i] == ' ')
 			CdromLabel[i] = 0;
 
-	// skip head and sub, and go to the root directory record
-	dir = (struct iso_directory_record *)&buf[12 + 156]; 
-
-	mmssdd(dir->extent, (char *)time);
-
-	READDIR(mdir);
-
-	if (GetCdromFile(mdir, time, "SYSTEM.CNF;1") != -1) {
+	if (GetCdromFile(time, "SYSTEM.CNF;1") != -1) {
 		READTRACK();
 
 		sscanf((char *)buf + 12, "BOOT = cdrom:\\%256s", exename);
-		if (GetCdromFile(mdir, time, exename) == -1) {
+		if (GetCdromFile(time, exename) == -1) {
 			sscanf((char *)buf + 12, "BOOT = cdrom:%256s", exename);
-			if (GetCdromFile(mdir, time, exename) == -1) {
+			if (GetCdromFile(time, exename) == -1) {
 				char *ptr = strstr((char*)buf + 12, "cdrom:");			// possibly the executable is in some subdir
 				if (ptr != NULL) {
 					ptr += 6;
@@ -312,13 +555,13 @@ int CheckCdrom() {
 					ptr = exename;
 					while (*ptr != '\0' && *ptr != '\r' && *ptr != '\n') ptr++;
 					*ptr = '\0';
-					if (GetCdromFile(mdir, time, exename) == -1)
+					if (GetCdromFile(time, exename) == -1)
 					 	return -1;		// main executable not found
 				} else
 					return -1;
 			}
 		}
-	} else if (GetCdromFile(mdir, time, "PSX.EXE;1") != -1) {
+	} else if (GetCdromFile(time, "PSX.EXE;1") != -1) {
 		strcpy(exename, "PSX.EXE;1");
 		strcpy(CdromId, "SLUS99999");
 	} else
@@ -461,10 +704,9 @@ static unsigned int savestates_slot = 0;
 extern unsigned char  *psxVub;
 extern unsigned short  spuMem[256*1024];
 #define iGPUHeight 512
-#define SAVE_STATE_MSG "Saving State .."
 #define LOAD_STATE_MSG "Loading State .."
 
-static const char PcsxHeader[32] = "STv4 PCSX v" PACKAGE_VERSION;
+static const char PcsxHeader[32] = "STv5 PCSX v" PACKAGE_VERSION;
 void savestates_select_slot(unsigned int s)
 {
    if (s > 9) {
@@ -475,16 +717,184 @@ void savestates_select_slot(unsigned int s)
 
 // Savestate Versioning!
 // If you make changes to the savestate version, please increment the value below.
-static const u32 SaveVersion = 0x8b410007;
+static const u32 SaveVersion = 0x8b410008;
+
+/*
+* A state is the header, the version and the HLE flag, then a table of
+* sections each deflated on its own. SaveState writes them in place and
+* LoadState inflates them straight back; both stream through one
+* STATE_CHUNK buffer, so nothing is ever held compressed in memory and
+* RAM and VRAM are never copied.
+*/
+
+enum {
+	STATE_PIC = 0,		// 128x96 screenshot
+	STATE_RAM,
+	STATE_BIOS,
+	STATE_HW,
+	STATE_CORE,			// psxCore up to psxM
+	STATE_GPU,
+	STATE_VRAM,
+	STATE_SPU,
+	STATE_SPURAM,
+	STATE_FREEZE,		// sio, cdr, hw, rcnt and mdec freezes
+	STATE_SECTIONS
+};
+
+typedef struct {
+	u32 id;
+	u32 size;			// inflated
+	u32 packed;			// as stored, == size when deflating didn't help
+	u32 offset;
+} StateSection;
+
+#define STATE_CORE_SIZE		((u32)offsetof(_psxCore, psxM))
+#define STATE_PIC_SIZE		(128 * 96 * 3)
+#define STATE_VRAM_SIZE		(1024 * iGPUHeight * 2)
+#define STATE_TABLE_OFFSET	(32 + sizeof(u32) + sizeof(boolean) + sizeof(u32))
+#define STATE_CHUNK			(16 * 1024)
+
+static u8 stateChunk[STATE_CHUNK];
+
+void FreezeWrite(FreezeBuf *f, const void *ptr, u32 size) {
+	if (f->pos + size > f->size) {
+		u8 *buf = (u8 *)realloc(f->buf, f->pos + size + 1024);
+		if (buf == NULL) {
+			f->error = TRUE;
+			return;
+		}
+		f->buf = buf;
+		f->size = f->pos + size + 1024;
+	}
+	memcpy(f->buf + f->pos, ptr, size);
+	f->pos += size;
+}
+
+void FreezeRead(FreezeBuf *f, void *ptr, u32 size) {
+	if (f->pos + size > f->size) {
+		memset(ptr, 0, size);
+		f->pos = f->size;
+		f->error = TRUE;
+		return;
+	}
+	memcpy(ptr, f->buf + f->pos, size);
+	f->pos += size;
+}
+
+// The sio, cdr, hw, rcnt and mdec freezes in one buffer: Mode 1 saves,
+// 0 loads and 2 only adds up their size in f->pos
+static void StateFreeze(FreezeBuf *f, int Mode) {
+	sioFreeze(f, Mode);
+	cdrFreeze(f, Mode);
+	psxHwFreeze(f, Mode);
+	psxRcntFreeze(f, Mode);
+	mdecFreeze(f, Mode);
+}
 
+// Size of the SPU plugin's freeze, 0 if it makes no sense. A plugin built
+// with a different layout (franspu's longs on a 64-bit host) says so here.
+static u32 StateSpuSize() {
+	SPUFreeze_t *info = (SPUFreeze_t *)malloc(sizeof(SPUFreeze_t));
+	u32 size = 0;
+
+	if (info == NULL) return 0;
+	memset(info, 0, sizeof(SPUFreeze_t));
+	SPU_freeze(2, info);
+	if (info->Size >= offsetof(SPUFreeze_t, SPUInfo))
+		size = info->Size;
+	free(info);
+	return size;
+}
+
+// Deflates a section into the file at offset, or stores it when that
+// doesn't make it smaller
+static int StateWrite(FILE *f, StateSection *s, const void *data, u32 offset) {
+	z_stream z;
+	int ret = Z_STREAM_ERROR;
+	u32 n;
+
+	s->offset = offset;
+	s->packed = 0;
+
+	memset(&z, 0, sizeof(z));
+	if (deflateInit(&z, Z_BEST_SPEED) == Z_OK) {
+		z.next_in = (Bytef *)data;
+		z.avail_in = s->size;
+		do {
+			z.next_out = stateChunk;
+			z.avail_out = STATE_CHUNK;
+			ret = deflate(&z, Z_FINISH);
+			n = STATE_CHUNK - z.avail_out;
+			if (s->packed + n >= s->size) {
+				ret = Z_BUF_ERROR;
+				break;
+			}
+			if (fwrite(stateChunk, 1, n, f) != n) {
+				deflateEnd(&z);
+				return -1;
+			}
+			s->packed += n;
+		} while (ret == Z_OK);
+		deflateEnd(&z);
+		if (ret == Z_STREAM_END)
+			return 0;
+	}
+
+	s->packed = s->size;
+	if (fseek(f, offset, SEEK_SET) != 0) return -1;
+	return fwrite(data, 1, s->size, f) == s->size ? 0 : -1;
+}
+
+// Returns 1 once the state is on disk, -1 if it couldn't be taken or written
 int SaveState() {
-	gzFile f;
+	FILE *f;
+	StateSection table[STATE_SECTIONS];
+	const void *data[STATE_SECTIONS];
 	GPUFreeze_t *gpufP;
 	SPUFreeze_t *spufP;
-	int Size;
-	unsigned char *pMem;
-		char *filename;
-	
+	FreezeBuf fb;
+	u32 i, offset, count = STATE_SECTIONS;
+	int ret = -1;
+	u8 *pic;
+	char *filename;
+
+	// everything the plugins and the freezes hand over goes into buffers
+	// of its own before the old state is overwritten
+	pic = (u8 *)malloc(STATE_PIC_SIZE);
+	if (pic != NULL)
+		GPU_getScreenPic(pic);
+
+	if (Config.HLE)
+		psxBiosFreeze(1);
+
+	gpufP = (GPUFreeze_t *)malloc(sizeof(GPUFreeze_t));
+	if (gpufP != NULL) {
+		gpufP->ulFreezeVersion = 1;
+		GPU_freeze(1, gpufP);
+	}
+
+	table[STATE_SPU].size = StateSpuSize();
+	spufP = table[STATE_SPU].size ? (SPUFreeze_t *)malloc(table[STATE_SPU].size) : NULL;
+	if (spufP != NULL)
+		SPU_freeze(1, spufP);
+
+	memset(&fb, 0, sizeof(fb));
+	StateFreeze(&fb, 1);
+
+	if (pic == NULL || gpufP == NULL || spufP == NULL || fb.error)
+		goto out;
+
+	data[STATE_PIC] = pic;					table[STATE_PIC].size = STATE_PIC_SIZE;
+	data[STATE_RAM] = psxCore.psxM;			table[STATE_RAM].size = 0x00200000;
+	data[STATE_BIOS] = psxCore.psxR;		table[STATE_BIOS].size = 0x00080000;
+	data[STATE_HW] = psxH;					table[STATE_HW].size = 0x00010000;
+	data[STATE_CORE] = &psxCore;			table[STATE_CORE].size = STATE_CORE_SIZE;
+	data[STATE_GPU] = gpufP;				table[STATE_GPU].size = sizeof(GPUFreeze_t);
+	data[STATE_VRAM] = &psxVub[0];			table[STATE_VRAM].size = STATE_VRAM_SIZE;
+	data[STATE_SPU] = spufP;
+	data[STATE_SPURAM] = &spuMem[0];		table[STATE_SPURAM].size = 0x80000;
+	data[STATE_FREEZE] = fb.buf;			table[STATE_FREEZE].size = fb.pos;
+
   /* fix the filename to %s.st%d format */
 	filename = malloc(1024);
 	
@@ -495,76 +905,143 @@ int SaveState() {
   sprintf(filename, "sd:%s%s.st%d", statespath, CdromId, savestates_slot);
 #endif
 
-	f = gzopen(filename, "wb");
-	if (f == NULL) return -1;
- LoadingBar_showBar(0.0f, SAVE_STATE_MSG);
+	f = fopen(filename, "wb");
+	free(filename);
+	if (f == NULL)
+		goto out;
+
+	fwrite(PcsxHeader, 1, 32, f);
+	fwrite(&SaveVersion, 1, sizeof(u32), f);
+	fwrite(&Config.HLE, 1, sizeof(boolean), f);
+	fwrite(&count, 1, sizeof(u32), f);
+
+	ret = 1;
+	offset = STATE_TABLE_OFFSET + sizeof(table);
+	if (fseek(f, offset, SEEK_SET) != 0) ret = -1;
+	for (i = 0; i < STATE_SECTIONS && ret > 0; i++) {
+		table[i].id = i;
+		if (StateWrite(f, &table[i], data[i], offset) != 0) ret = -1;
+		offset += table[i].packed;
+	}
 
-	gzwrite(f, (void *)PcsxHeader, 32);
-	gzwrite(f, (void *)&SaveVersion, sizeof(u32));
-	gzwrite(f, (void *)&Config.HLE, sizeof(boolean));
+	// now that the sizes are known
+	if (ret > 0 && (fseek(f, STATE_TABLE_OFFSET, SEEK_SET) != 0 ||
+		fwrite(table, 1, sizeof(table), f) != sizeof(table)))
+		ret = -1;
+	if (ferror(f)) ret = -1;
+	if (fclose(f) != 0) ret = -1;
 
-	pMem = (unsigned char *)malloc(128 * 96 * 3);
-	if (pMem == NULL) return -1;
-	GPU_getScreenPic(pMem);
-	gzwrite(f, pMem, 128 * 96 * 3);
-	free(pMem);
+out:
+	free(pic);
+	free(gpufP);
+	free(spufP);
+	free(fb.buf);
+	return ret;
+}
 
-	if (Config.HLE)
-		psxBiosFreeze(1);
+// Reads the header and section table, returns -1 if it's not a state
+// this build can load
+static int StateReadTable(FILE *f, StateSection *table) {
+	char header[32];
+	u32 version, count;
+	boolean hle;
 
-	 LoadingBar_showBar(0.10f, SAVE_STATE_MSG);
-	// TODO fix this, we're storing it twice.
-	gzwrite(f, psxCore.psxM, 0x00200000);
-	LoadingBar_showBar(0.40f, SAVE_STATE_MSG);
-	gzwrite(f, psxCore.psxR, 0x00080000);
-	LoadingBar_showBar(0.60f, SAVE_STATE_MSG);
-	gzwrite(f, psxH, 0x00010000);
-	gzwrite(f, (void*)&psxCore, sizeof(psxCore));
-	LoadingBar_showBar(0.70f, SAVE_STATE_MSG);
+	if (fread(header, 1, sizeof(header), f) != sizeof(header) ||
+		fread(&version, 1, sizeof(u32), f) != sizeof(u32) ||
+		fread(&hle, 1, sizeof(boolean), f) != sizeof(boolean) ||
+		fread(&count, 1, sizeof(u32), f) != sizeof(u32))
+		return -1;
 
-	// gpu
-	gpufP = (GPUFreeze_t *)malloc(sizeof(GPUFreeze_t));
-	gpufP->ulFreezeVersion = 1;
-	GPU_freeze(1, gpufP);
-	gzwrite(f, gpufP, sizeof(GPUFreeze_t));
-	free(gpufP);
-	// gpu VRAM save (save directly to save memory)
-	gzwrite(f, &psxVub[0], 1024*iGPUHeight*2);
-	LoadingBar_showBar(0.80f, SAVE_STATE_MSG);
-	// spu
-	spufP = (SPUFreeze_t *) malloc(16);
-	SPU_freeze(2, spufP);
-	Size = spufP->Size; gzwrite(f, &Size, 4);
-	free(spufP);
-	spufP = (SPUFreeze_t *) malloc(Size);
-	SPU_freeze(1, spufP);
-	gzwrite(f, spufP, Size);
-	free(spufP);
-	// spu spuMem save (save directly to save memory)
-	gzwrite(f, &spuMem[0], 0x80000);
-	LoadingBar_showBar(0.90f, SAVE_STATE_MSG);
-	sioFreeze(f, 1);
-	cdrFreeze(f, 1);
-	psxHwFreeze(f, 1);
-	psxRcntFreeze(f, 1);
-	mdecFreeze(f, 1);
-	LoadingBar_showBar(0.99f, SAVE_STATE_MSG);
-	gzclose(f);
-	
-	LoadingBar_showBar(1.0f, SAVE_STATE_MSG);
-	return 1;
+	if (strncmp("STv5 PCSX", header, 9) != 0 || version != SaveVersion || hle != Config.HLE ||
+		count != STATE_SECTIONS)
+		return -1;
+
+	if (table != NULL && fread(table, 1, sizeof(StateSection) * count, f) != sizeof(StateSection) * count)
+		return -1;
+
+	return 0;
+}
+
+// Checks every section against what this build would have saved, so a
+// state that can't be loaded is turned down before the machine is touched
+static int StateCheckTable(FILE *f, const StateSection *table) {
+	u32 size[STATE_SECTIONS];
+	FreezeBuf fb;
+	long end;
+	u32 i;
+
+	memset(&fb, 0, sizeof(fb));
+	StateFreeze(&fb, 2);
+
+	size[STATE_PIC] = STATE_PIC_SIZE;
+	size[STATE_RAM] = 0x00200000;
+	size[STATE_BIOS] = 0x00080000;
+	size[STATE_HW] = 0x00010000;
+	size[STATE_CORE] = STATE_CORE_SIZE;
+	size[STATE_GPU] = sizeof(GPUFreeze_t);
+	size[STATE_VRAM] = STATE_VRAM_SIZE;
+	size[STATE_SPU] = StateSpuSize();
+	size[STATE_SPURAM] = 0x80000;
+	size[STATE_FREEZE] = fb.pos;
+
+	if (fseek(f, 0, SEEK_END) != 0 || (end = ftell(f)) < 0) return -1;
+
+	for (i = 0; i < STATE_SECTIONS; i++) {
+		const StateSection *s = &table[i];
+
+		if (s->id != i || s->size != size[i] || s->size == 0 || s->packed == 0 || s->packed > s->size ||
+			s->offset > (u32)end || s->packed > (u32)end - s->offset)
+			return -1;
+	}
+	return 0;
+}
+
+// Inflates a section straight into dst, which holds s->size bytes
+static int StateRead(FILE *f, const StateSection *s, void *dst) {
+	z_stream z;
+	u32 left;
+	int ret;
+
+	if (fseek(f, s->offset, SEEK_SET) != 0) return -1;
+
+	if (s->packed == s->size)
+		return fread(dst, 1, s->size, f) == s->size ? 0 : -1;
+
+	memset(&z, 0, sizeof(z));
+	if (inflateInit(&z) != Z_OK) return -1;
+	z.next_out = (Bytef *)dst;
+	z.avail_out = s->size;
+
+	left = s->packed;
+	do {
+		u32 n = left < STATE_CHUNK ? left : STATE_CHUNK;
+
+		if (n == 0 || fread(stateChunk, 1, n, f) != n) {
+			ret = Z_DATA_ERROR;
+			break;
+		}
+		left -= n;
+		z.next_in = stateChunk;
+		z.avail_in = n;
+		ret = inflate(&z, Z_NO_FLUSH);
+	} while (ret == Z_OK);
+	inflateEnd(&z);
+
+	return (ret == Z_STREAM_END && z.avail_out == 0) ? 0 : -1;
 }
 
+// Returns 1 once loaded, 0 if there is no state in the slot and -1 if it
+// can't be loaded. The machine is only left half loaded when a section
+// that passed the table checks turns out to be corrupt.
 int LoadState() {
-	gzFile f;
+	FILE *f;
 	GPUFreeze_t *gpufP;
 	SPUFreeze_t *spufP;
-	int Size;
-	char header[32];
-	u32 version;
-	boolean hle;
+	StateSection table[STATE_SECTIONS];
+	FreezeBuf fb;
+	int ret = -1;
 	char *filename;
-	
+
   /* fix the filename to %s.st%d format */
 	filename = malloc(1024);
 #ifdef HW_RVL
@@ -574,92 +1051,80 @@ int LoadState() {
   sprintf(filename, "sd:%s%s.st%d", statespath, CdromId, savestates_slot);
 #endif
 
-	f = gzopen(filename, "rb");
+	f = fopen(filename, "rb");
   free(filename);
    	
   if(!f) 
   	return 0;
 
-	gzread(f, header, sizeof(header));
-	gzread(f, &version, sizeof(u32));
-	gzread(f, &hle, sizeof(boolean));
-
-	if (strncmp("STv4 PCSX", header, 9) != 0 || version != SaveVersion || hle != Config.HLE) {
-		gzclose(f);
+	if (StateReadTable(f, table) != 0 || StateCheckTable(f, table) != 0) {
+		fclose(f);
 		return -1;
 	}
 
+	gpufP = (GPUFreeze_t *) malloc (sizeof(GPUFreeze_t));
+	spufP = (SPUFreeze_t *) malloc (table[STATE_SPU].size);
+	memset(&fb, 0, sizeof(fb));
+	fb.size = table[STATE_FREEZE].size;
+	fb.buf = (u8 *) malloc (fb.size);
+	if (gpufP == NULL || spufP == NULL || fb.buf == NULL)
+		goto out;
+
 	LoadingBar_showBar(0.0f, LOAD_STATE_MSG);
 	//SysReset();
 	
 	psxCpu->Reset();
   LoadingBar_showBar(0.10f, LOAD_STATE_MSG);
-	gzread(f, header, 32);
-
-	if (strncmp("STv3 PCSX", header, 9)) { gzclose(f); return -1; }
-
-	gzseek(f, 128*96*3, SEEK_CUR);
-	// TODO fix this, we're storing it twice.
-	gzread(f, psxCore.psxM, 0x00200000);
-	LoadingBar_showBar(0.40f, LOAD_STATE_MSG);
-	gzread(f, psxCore.psxR, 0x00080000);
-	LoadingBar_showBar(0.60f, LOAD_STATE_MSG);
-	gzread(f, psxH, 0x00010000);
-	gzread(f, (void*)&psxCore, sizeof(psxCore));
-  LoadingBar_showBar(0.70f, LOAD_STATE_MSG);
+
+	if (StateRead(f, &table[STATE_RAM], psxCore.psxM) ||
+		StateRead(f, &table[STATE_BIOS], psxCore.psxR) ||
+		StateRead(f, &table[STATE_HW], psxH) ||
+		StateRead(f, &table[STATE_CORE], &psxCore))
+		goto out;
+  LoadingBar_showBar(0.50f, LOAD_STATE_MSG);
 	if (Config.HLE)
 		psxBiosFreeze(0);
 
 	// gpu
-	gpufP = (GPUFreeze_t *) malloc (sizeof(GPUFreeze_t));
-	gzread(f, gpufP, sizeof(GPUFreeze_t));
+	if (StateRead(f, &table[STATE_GPU], gpufP) ||
+		StateRead(f, &table[STATE_VRAM], &psxVub[0]))
+		goto out;
 	GPU_freeze(0, gpufP);
-	free(gpufP);
-	// gpu VRAM load (load directly to save memory)
-	gzread(f, &psxVub[0], 1024*iGPUHeight*2);
 	LoadingBar_showBar(0.80f, LOAD_STATE_MSG);
-	
+
 	// spu
-	gzread(f, &Size, 4);
-	spufP = (SPUFreeze_t *) malloc (Size);
-	gzread(f, spufP, Size);
+	if (StateRead(f, &table[STATE_SPU], spufP) ||
+		StateRead(f, &table[STATE_SPURAM], &spuMem[0]))
+		goto out;
 	SPU_freeze(0, spufP);
-	free(spufP);
-  // spu spuMem save (save directly to save memory)
-  gzread(f, &spuMem[0], 0x80000);
   LoadingBar_showBar(0.99f, LOAD_STATE_MSG);
-  
-	sioFreeze(f, 0);
-	cdrFreeze(f, 0);
-	psxHwFreeze(f, 0);
-	psxRcntFreeze(f, 0);
-	mdecFreeze(f, 0);
 
-	gzclose(f);
+	if (StateRead(f, &table[STATE_FREEZE], fb.buf))
+		goto out;
+	StateFreeze(&fb, 0);
+	ret = 1;
+
+out:
+	free(gpufP);
+	free(spufP);
+	free(fb.buf);
+	fclose(f);
   LoadingBar_showBar(1.0f, LOAD_STATE_MSG);
   
-	return 1;
+	return ret;
 }
 
 int CheckState(const char *file) {
-	gzFile f;
-	char header[32];
-	u32 version;
-	boolean hle;
+	FILE *f;
+	int ret;
 
-	f = gzopen(file, "rb");
+	f = fopen(file, "rb");
 	if (f == NULL) return -1;
 
-	gzread(f, header, sizeof(header));
-	gzread(f, &version, sizeof(u32));
-	gzread(f, &hle, sizeof(boolean));
-
-	gzclose(f);
+	ret = StateReadTable(f, NULL);
+	fclose(f);
 
-	if (strncmp("STv4 PCSX", header, 9) != 0 || version != SaveVersion || hle != Config.HLE)
-		return -1;
-
-	return 0;
+	return ret;
 }
 
 // NET Function Helpers
@@ -59,6 +59,8 @@ extern char CdromLabel[33];
 
 int LoadCdrom();
 int LoadCdromFile(const char *filename, EXE_HEADER *head);
+int CdromIndexFind(const char *path, u32 *lba, u32 *size);
+int LoadCdromData(u32 lba, u32 offset, u32 addr, u32 len);
 int CheckCdrom();
 int Load(fileBrowser_file *exe);
 
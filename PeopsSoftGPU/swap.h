@@ -87,9 +87,9 @@ __inline__ void PUTLE32(unsigned long *ptr, unsigned long val) {
 }
 #endif
 #else // _BIG_ENDIAN
-#define GETLE16(X) ((unsigned short *)X)
-#define GETLE32(X) ((unsigned long *)X)
-#define GETLE16D(X) ({unsigned long val = GETLE32(X); (val<<16 | val >> 16)})
-#define PUTLE16(X, Y) {((unsigned short *)X)=(unsigned short)X}
-#define PUTLE32(X, Y) {((unsigned long *)X)=(unsigned long)X}
+#define GETLE16(X) (*(unsigned short *)(X))
+#define GETLE32(X) (*(unsigned long *)(X))
+#define GETLE16D(X) ({unsigned long val = GETLE32(X); (val<<16 | val >> 16);})
+#define PUTLE16(X, Y) {*((unsigned short *)(X))=(unsigned short)(Y);}
+#define PUTLE32(X, Y) {*((unsigned long *)(X))=(unsigned long)(Y);}
 #endif //!_BIG_ENDIAN
@@ -256,6 +256,7 @@ static int CardState = -1;
 static TCB Thread[8];
 static int CurThread = 0;
 static FileDesc FDesc[32];
+#define CDFD_FIRST 4 // cdrom: files from here on, mcfile holds their first sector
 static u32 card_active_chan = 0;
 
 boolean hleSoftCall = FALSE;
@@ -1634,6 +1635,25 @@ void psxBios_UnDeliverEvent() { // 0x20
 	pc0 = ra;
 }
 
+// Resolved through the disc index, no CD-ROM commands are emulated
+#define cdopen() { \
+	u32 lba, size; \
+ \
+	if (CdromIndexFind(Ra0, &lba, &size) == 0) { \
+		for (i=CDFD_FIRST; i<32; i++) { \
+			if (FDesc[i].name[0]) continue; \
+			strncpy(FDesc[i].name, Ra0+6, 31); \
+			FDesc[i].name[31] = 0; \
+			FDesc[i].offset = 0; \
+			FDesc[i].mode   = a1; \
+			FDesc[i].size   = size; \
+			FDesc[i].mcfile = lba; \
+			v0 = i; \
+			break; \
+		} \
+	} \
+}
+
 #define buopen(mcdslot) { \
 	strcpy(FDesc[1 + mcdslot].name, Ra0+5); \
 	FDesc[1 + mcdslot].offset = 0; \
@@ -1695,6 +1715,10 @@ void psxBios_open() { // 0x32
 		buopen(2);
 	}
 
+	if (!strnicmp(Ra0, "cdrom:", 6)) {
+		cdopen();
+	}
+
 	pc0 = ra;
 }
 
@@ -1707,6 +1731,12 @@ void psxBios_lseek() { // 0x33
 	PSXBIOS_LOG("psxBios_%s: %x, %x, %x\n", biosB0n[0x33], a0, a1, a2);
 #endif
 
+	if (a0 >= 32) {
+		v0 = -1;
+		pc0 = ra;
+		return;
+	}
+
 	switch (a2) {
 		case 0: // SEEK_SET
 			FDesc[a0].offset = a1;
@@ -1719,6 +1749,12 @@ void psxBios_lseek() { // 0x33
 			FDesc[a0].offset+= a1;
 			v0 = FDesc[a0].offset;
 			break;
+
+		case 2: // SEEK_END, only cdrom: files know their size
+			if (a0 < CDFD_FIRST) break;
+			FDesc[a0].offset = FDesc[a0].size + a1;
+			v0 = FDesc[a0].offset;
+			break;
 	}
 
 	pc0 = ra;
@@ -1735,6 +1771,20 @@ void psxBios_lseek() { // 0x33
 	DeliverEvent(0x81, 0x2); /* 0xf4000001, 0x0004 */ \
 }
 
+// The sectors go straight from the disc image into RAM
+#define cdread() { \
+	u32 len = a2; \
+ \
+	if (FDesc[a0].offset >= FDesc[a0].size) len = 0; \
+	else if (len > FDesc[a0].size - FDesc[a0].offset) len = FDesc[a0].size - FDesc[a0].offset; \
+	if (LoadCdromData(FDesc[a0].mcfile, FDesc[a0].offset, a1, len) == 0) { \
+		psxCpu->Clear(a1, (len + 3) / 4); \
+		FDesc[a0].offset += len; \
+		v0 = len; \
+	} \
+	DeliverEvent(0x03, 0x5); /* 0xf0000003, 0x0020 */ \
+}
+
 /*
  *	int read(int fd , void *buf , int nbytes);
  */
@@ -1751,6 +1801,9 @@ void psxBios_read() { // 0x34
 	switch (a0) {
 		case 2: buread(1); break;
 		case 3: buread(2); break;
+		default:
+			if (a0 >= CDFD_FIRST && a0 < 32 && FDesc[a0].name[0]) cdread();
+			break;
 	}
   		
 	pc0 = ra;
@@ -1807,6 +1860,9 @@ void psxBios_close() { // 0x36
 	PSXBIOS_LOG("psxBios_%s: %x\n", biosB0n[0x36], a0);
 #endif
 
+	if (a0 >= CDFD_FIRST && a0 < 32)
+		memset(&FDesc[a0], 0, sizeof(FileDesc));
+
 	v0 = a0;
 	pc0 = ra;
 }
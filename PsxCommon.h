@@ -118,6 +118,8 @@ typedef struct {
 	boolean UseNet;
 	boolean VSyncWA;
 	u8 Cpu; // CPU_DYNAREC or CPU_INTERPRETER
+	u8 CpuClock; // CPU_CLOCK_*, saved per game
+	u8 CdSpeed; // CD_SPEED_*, overridable per game
 	u8 PsxType; // PSX_TYPE_NTSC or PSX_TYPE_PAL
 #ifdef _WIN32
 	char Lang[256];
@@ -127,9 +129,22 @@ typedef struct {
 extern PcsxConfig Config;
 extern boolean NetOpened;
 
+// Memory stream the *Freeze functions save to and load from
+typedef struct {
+	u8 *buf;
+	u32 pos, size;
+	boolean error;		// out of memory saving, or past the end loading
+} FreezeBuf;
+
+void FreezeWrite(FreezeBuf *f, const void *ptr, u32 size);
+void FreezeRead(FreezeBuf *f, void *ptr, u32 size);
+
+// Mode 1 saves, 0 loads and 2 only counts the bytes a save would take,
+// like the plugins' freeze info mode
 #define gzfreeze(ptr, size) { \
-	if (Mode == 1) gzwrite(f, ptr, size); \
-	if (Mode == 0) gzread(f, ptr, size); \
+	if (Mode == 1) FreezeWrite(f, ptr, size); \
+	if (Mode == 0) FreezeRead(f, ptr, size); \
+	if (Mode == 2) f->pos += size; \
 }
 
 // Make the timing events trigger faster as we are currently assuming everything
@@ -148,6 +163,20 @@ enum {
 	CPU_INTERPRETER
 }; // CPU Types
 
+enum {
+	CPU_CLOCK_1X = 0,
+	CPU_CLOCK_1_5X,
+	CPU_CLOCK_2X,
+	CPU_CLOCK_3X
+}; // CPU overclock factors
+
+enum {
+	CD_SPEED_NORMAL = 0,
+	CD_SPEED_4X,
+	CD_SPEED_8X,
+	CD_SPEED_INSTANT
+}; // Fast CD factors over the drive's own speed
+
 enum {
 	BIOS_USER_DEFINED,
 	BIOS_HLE
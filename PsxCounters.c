@@ -21,6 +21,8 @@
  * Internal PSX counters.
  */
 #include "psxcounters.h"
+#include "psxtrace.h"
+#include "Gamecube/DEBUG.h"
 
 /******************************************************************************/
 
@@ -279,7 +281,8 @@ void psxRcntUpdate()
 
             if( SPU_async )
             {
-                SPU_async( SpuUpdInterval[Config.PsxType] * rcnts[3].target );
+                PSXTRACE_CALL(PSXTRACE_SPUASYNC, SpuUpdInterval[Config.PsxType] * rcnts[3].target,
+                    SPU_async( SpuUpdInterval[Config.PsxType] * rcnts[3].target ));
             }
         }
 
@@ -300,7 +303,7 @@ void psxRcntUpdate()
             GPU_vBlank( 0 );
             setIrq( 0x01 );
 
-            GPU_updateLace();
+            PSXTRACE_CALL(PSXTRACE_UPDATELACE, 0, GPU_updateLace());
             EmuUpdate();
         }
     }
@@ -471,7 +474,7 @@ void psxRcntInit()
 
 /******************************************************************************/
 
-s32 psxRcntFreeze( gzFile f, s32 Mode )
+s32 psxRcntFreeze( FreezeBuf *f, s32 Mode )
 {
     gzfreeze( &rcnts, sizeof(rcnts) );
     gzfreeze( &hSyncCount, sizeof(hSyncCount) );
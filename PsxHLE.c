@@ -22,6 +22,7 @@
 */
 
 #include "psxhle.h"
+#include "psxprof.h"
 
 static void hleDummy() {
 	psxCore.pc = psxCore.GPR.n.ra;
@@ -32,6 +33,7 @@ static void hleDummy() {
 static void hleA0() {
 	u32 call = psxCore.GPR.n.t1 & 0xff;
 
+	PSXPROF_BIOS(0, call);
 	if (biosA0[call]) biosA0[call]();
 
 	psxBranchTest();
@@ -40,6 +42,7 @@ static void hleA0() {
 static void hleB0() {
 	u32 call = psxCore.GPR.n.t1 & 0xff;
 
+	PSXPROF_BIOS(1, call);
 	if (biosB0[call]) biosB0[call]();
 
 	psxBranchTest();
@@ -48,6 +51,7 @@ static void hleB0() {
 static void hleC0() {
 	u32 call = psxCore.GPR.n.t1 & 0xff;
 
+	PSXPROF_BIOS(2, call);
 	if (biosC0[call]) biosC0[call]();
 
 	psxBranchTest();
@@ -25,731 +25,457 @@
 #include "mdec.h"
 #include "cdrom.h"
 #include "PsxGpu.h"
+#include "psxprof.h"
 
-void psxHwReset() {
-	if (Config.Sio) psxHu32ref(0x1070) |= SWAP32(0x80);
-	if (Config.SpuIrq) psxHu32ref(0x1070) |= SWAP32(0x200);
-
-	memset(psxH, 0, 0x10000);
-
-	mdecInit(); // initialize mdec decoder
-	cdrReset();
-	psxRcntInit();
+/*
+ * Registers are dispatched through per-width handler tables covering
+ * 0x1f801000-0x1f801fff, filled in by psxHwReset(). The 8 and 32bit tables
+ * have one slot per word, the 16bit one a slot per halfword. Anything
+ * not mapped reads and writes the psxH backing store.
+ */
+
+#define HW_BASE		0x1f801000
+#define HW_SIZE		0x1000
+
+typedef u8 (*psxHwRead8Func)(u32 add);
+typedef u16 (*psxHwRead16Func)(u32 add);
+typedef u32 (*psxHwRead32Func)(u32 add);
+typedef void (*psxHwWrite8Func)(u32 add, u8 value);
+typedef void (*psxHwWrite16Func)(u32 add, u16 value);
+typedef void (*psxHwWrite32Func)(u32 add, u32 value);
+
+static psxHwRead8Func hwRead8[HW_SIZE >> 2];
+static psxHwRead16Func hwRead16[HW_SIZE >> 1];
+static psxHwRead32Func hwRead32[HW_SIZE >> 2];
+static psxHwWrite8Func hwWrite8[HW_SIZE >> 2];
+static psxHwWrite16Func hwWrite16[HW_SIZE >> 1];
+static psxHwWrite32Func hwWrite32[HW_SIZE >> 2];
+
+/* Unmapped registers */
+
+static u8 hwRead8Mem(u32 add) { return psxHu8(add); }
+static u16 hwRead16Mem(u32 add) { return psxHu16(add); }
+static u32 hwRead32Mem(u32 add) { return psxHu32(add); }
+static void hwWrite8Mem(u32 add, u8 value) { psxHu8ref(add) = value; }
+static void hwWrite16Mem(u32 add, u16 value) { psxHu16ref(add) = SWAPu16(value); }
+static void hwWrite32Mem(u32 add, u32 value) { psxHu32ref(add) = SWAPu32(value); }
+
+/* SIO */
+
+static u8 hwRead8Sio(u32 add) {
+	return (add & 3) ? psxHu8(add) : sioRead8();
 }
 
-u8 psxHwRead8(u32 add) {
-	unsigned char hard;
+static u16 hwRead16Sio(u32 add) {
+	u16 hard;
 
-	switch (add) {
-		case 0x1f801040: hard = sioRead8();break; 
-#ifdef ENABLE_SIO1API
-		case 0x1f801050: hard = SIO1_readData8(); break;
-#endif
-		case 0x1f801800: hard = cdrRead0(); break;
-		case 0x1f801801: hard = cdrRead1(); break;
-		case 0x1f801802: hard = cdrRead2(); break;
-		case 0x1f801803: hard = cdrRead3(); break;
-		default:
-			hard = psxHu8(add); 
-#ifdef PSXHW_LOG
-			PSXHW_LOG("*Unkwnown 8bit read at address %x\n", add);
-#endif
-			return hard;
+	switch (add & 0xf) {
+		case 0x0:
+			hard = sioRead8();
+			hard|= sioRead8() << 8;
+			break;
+		case 0x4: hard = sioReadStat16(); break;
+		case 0x8: hard = sioReadMode16(); break;
+		case 0xa: hard = sioReadCtrl16(); break;
+		case 0xe: hard = sioReadBaud16(); break;
+		default: return psxHu16(add);
 	}
-
-#ifdef PSXHW_LOG
-	PSXHW_LOG("*Known 8bit read at address %x value %x\n", add, hard);
+#ifdef PAD_LOG
+	PAD_LOG("sio read16 %x; ret = %x\n", add&0xf, hard);
 #endif
 	return hard;
 }
 
-u16 psxHwRead16(u32 add) {
-	unsigned short hard;
-
-	switch (add) {
-#ifdef PSXHW_LOG
-		case 0x1f801070: PSXHW_LOG("IREG 16bit read %x\n", psxHu16(0x1070));
-			return psxHu16(0x1070);
-#endif
-#ifdef PSXHW_LOG
-		case 0x1f801074: PSXHW_LOG("IMASK 16bit read %x\n", psxHu16(0x1074));
-			return psxHu16(0x1074);
-#endif
+static u32 hwRead32Sio(u32 add) {
+	u32 hard;
 
-		case 0x1f801040:
-			hard = sioRead8();
-			hard|= sioRead8() << 8;
-#ifdef PAD_LOG
-			PAD_LOG("sio read16 %x; ret = %x\n", add&0xf, hard);
-#endif
-			return hard;
-		case 0x1f801044:
-			hard = sioReadStat16();
-#ifdef PAD_LOG
-			PAD_LOG("sio read16 %x; ret = %x\n", add&0xf, hard);
-#endif
-			return hard;
-		case 0x1f801048:
-			hard = sioReadMode16();
+	hard = sioRead8();
+	hard |= sioRead8() << 8;
+	hard |= sioRead8() << 16;
+	hard |= sioRead8() << 24;
 #ifdef PAD_LOG
-			PAD_LOG("sio read16 %x; ret = %x\n", add&0xf, hard);
+	PAD_LOG("sio read32 ;ret = %x\n", hard);
 #endif
-			return hard;
-		case 0x1f80104a:
-			hard = sioReadCtrl16();
+	return hard;
+}
+
+static void hwWrite8Sio(u32 add, u8 value) {
+	if (!(add & 3)) sioWrite8(value);
+	psxHu8ref(add) = value;
+}
+
+static void hwWrite16Sio(u32 add, u16 value) {
+	switch (add & 0xf) {
+		case 0x0:
+			sioWrite8((unsigned char)value);
+			sioWrite8((unsigned char)(value>>8));
+			break;
+		case 0x4: sioWriteStat16(value); break;
+		case 0x8: sioWriteMode16(value); break;
+		case 0xa: sioWriteCtrl16(value); break; // control register
+		case 0xe: sioWriteBaud16(value); break; // baudrate register
+		default:
+			psxHu16ref(add) = SWAPu16(value);
+			return;
+	}
 #ifdef PAD_LOG
-			PAD_LOG("sio read16 %x; ret = %x\n", add&0xf, hard);
+	PAD_LOG ("sio write16 %x, %x\n", add&0xf, value);
 #endif
-			return hard;
-		case 0x1f80104e:
-			hard = sioReadBaud16();
+}
+
+static void hwWrite32Sio(u32 add, u32 value) {
+	sioWrite8((unsigned char)value);
+	sioWrite8((unsigned char)((value&0xff) >>  8));
+	sioWrite8((unsigned char)((value&0xff) >> 16));
+	sioWrite8((unsigned char)((value&0xff) >> 24));
 #ifdef PAD_LOG
-			PAD_LOG("sio read16 %x; ret = %x\n", add&0xf, hard);
+	PAD_LOG("sio write32 %x\n", value);
 #endif
-			return hard;
+}
+
 #ifdef ENABLE_SIO1API
-		case 0x1f801050:
-			hard = SIO1_readData16();
-			return hard;
-		case 0x1f801054:
-			hard = SIO1_readStat16();
-			return hard;
-		case 0x1f80105a:
-			hard = SIO1_readCtrl16();
-			return hard;
-		case 0x1f80105e:
-			hard = SIO1_readBaud16();
-			return hard;
-#endif
-		case 0x1f801100:
-			hard = psxRcntRcount(0);
-#ifdef PSXHW_LOG
-			PSXHW_LOG("T0 count read16: %x\n", hard);
-#endif
-			return hard;
-		case 0x1f801104:
-			hard = psxRcntRmode(0);
-#ifdef PSXHW_LOG
-			PSXHW_LOG("T0 mode read16: %x\n", hard);
-#endif
-			return hard;
-		case 0x1f801108:
-			hard = psxRcntRtarget(0);
-#ifdef PSXHW_LOG
-			PSXHW_LOG("T0 target read16: %x\n", hard);
-#endif
-			return hard;
-		case 0x1f801110:
-			hard = psxRcntRcount(1);
-#ifdef PSXHW_LOG
-			PSXHW_LOG("T1 count read16: %x\n", hard);
-#endif
-			return hard;
-		case 0x1f801114:
-			hard = psxRcntRmode(1);
-#ifdef PSXHW_LOG
-			PSXHW_LOG("T1 mode read16: %x\n", hard);
-#endif
-			return hard;
-		case 0x1f801118:
-			hard = psxRcntRtarget(1);
-#ifdef PSXHW_LOG
-			PSXHW_LOG("T1 target read16: %x\n", hard);
-#endif
-			return hard;
-		case 0x1f801120:
-			hard = psxRcntRcount(2);
-#ifdef PSXHW_LOG
-			PSXHW_LOG("T2 count read16: %x\n", hard);
-#endif
-			return hard;
-		case 0x1f801124:
-			hard = psxRcntRmode(2);
-#ifdef PSXHW_LOG
-			PSXHW_LOG("T2 mode read16: %x\n", hard);
-#endif
-			return hard;
-		case 0x1f801128:
-			hard = psxRcntRtarget(2);
-#ifdef PSXHW_LOG
-			PSXHW_LOG("T2 target read16: %x\n", hard);
-#endif
-			return hard;
+static u8 hwRead8Sio1(u32 add) {
+	return (add & 3) ? psxHu8(add) : SIO1_readData8();
+}
 
-		//case 0x1f802030: hard =   //int_2000????
-		//case 0x1f802040: hard =//dip switches...??
+static u16 hwRead16Sio1(u32 add) {
+	switch (add & 0xf) {
+		case 0x0: return SIO1_readData16();
+		case 0x4: return SIO1_readStat16();
+		case 0xa: return SIO1_readCtrl16();
+		case 0xe: return SIO1_readBaud16();
+	}
+	return psxHu16(add);
+}
 
-		default:
-			if (add >= 0x1f801c00 && add < 0x1f801e00) {
-            	hard = SPU_readRegister(add);
-			} else {
-				hard = psxHu16(add); 
-#ifdef PSXHW_LOG
-				PSXHW_LOG("*Unkwnown 16bit read at address %x\n", add);
-#endif
-			}
-            return hard;
+static u32 hwRead32Sio1(u32 add) {
+	return SIO1_readData32();
+}
+
+static void hwWrite8Sio1(u32 add, u8 value) {
+	if (!(add & 3)) SIO1_writeData8(value);
+	psxHu8ref(add) = value;
+}
+
+static void hwWrite16Sio1(u32 add, u16 value) {
+	switch (add & 0xf) {
+		case 0x0: SIO1_writeData16(value); break;
+		case 0x4: SIO1_writeStat16(value); break;
+		case 0xa: SIO1_writeCtrl16(value); break;
+		case 0xe: SIO1_writeBaud16(value); break;
+		default: psxHu16ref(add) = SWAPu16(value); break;
 	}
-	
-#ifdef PSXHW_LOG
-	PSXHW_LOG("*Known 16bit read at address %x value %x\n", add, hard);
+}
+
+static void hwWrite32Sio1(u32 add, u32 value) {
+	SIO1_writeData32(value);
+}
 #endif
-	return hard;
+
+/* Interrupt controller */
+
+static void hwWrite16Ireg(u32 add, u16 value) {
+	if (Config.Sio) psxHu16ref(0x1070) |= SWAPu16(0x80);
+	if (Config.SpuIrq) psxHu16ref(0x1070) |= SWAPu16(0x200);
+	psxHu16ref(0x1070) &= SWAPu16((psxHu16(0x1074) & value));
 }
 
-u32 psxHwRead32(u32 add) {
-	u32 hard;
+static void hwWrite32Ireg(u32 add, u32 value) {
+	if (Config.Sio) psxHu32ref(0x1070) |= SWAPu32(0x80);
+	if (Config.SpuIrq) psxHu32ref(0x1070) |= SWAPu32(0x200);
+	psxHu32ref(0x1070) &= SWAPu32((psxHu32(0x1074) & value));
+}
 
-	switch (add) {
-		case 0x1f801040:
-			hard = sioRead8();
-			hard |= sioRead8() << 8;
-			hard |= sioRead8() << 16;
-			hard |= sioRead8() << 24;
-#ifdef PAD_LOG
-			PAD_LOG("sio read32 ;ret = %x\n", hard);
-#endif
-			return hard;
-#ifdef ENABLE_SIO1API
-		case 0x1f801050:
-			hard = SIO1_readData32();
-			return hard;
-#endif
-#ifdef PSXHW_LOG
-		case 0x1f801060:
-			PSXHW_LOG("RAM size read %x\n", psxHu32(0x1060));
-			return psxHu32(0x1060);
-#endif
-#ifdef PSXHW_LOG
-		case 0x1f801070: PSXHW_LOG("IREG 32bit read %x\n", psxHu32(0x1070));
-			return psxHu32(0x1070);
-#endif
-#ifdef PSXHW_LOG
-		case 0x1f801074: PSXHW_LOG("IMASK 32bit read %x\n", psxHu32(0x1074));
-			return psxHu32(0x1074);
-#endif
+/* DMA */
 
-		case 0x1f801810:
-			hard = GPU_readData();
-#ifdef PSXHW_LOG
-			PSXHW_LOG("GPU DATA 32bit read %x\n", hard);
-#endif
-			return hard;
-		case 0x1f801814:
-			hard = gpuReadStatus();
-#ifdef PSXHW_LOG
-			PSXHW_LOG("GPU STATUS 32bit read %x\n", hard);
-#endif
-			return hard;
+#define DmaExec(n) { \
+	HW_DMA##n##_CHCR = SWAPu32(value); \
+\
+	if (SWAPu32(HW_DMA##n##_CHCR) & 0x01000000 && SWAPu32(HW_DMA_PCR) & (8 << (n * 4))) { \
+		PSXPROF_DMA(n); \
+		PSXTRACE(PSXTRACE_DMA_START, n, SWAPu32(HW_DMA##n##_MADR), SWAPu32(HW_DMA##n##_BCR)); \
+		psxDma##n(SWAPu32(HW_DMA##n##_MADR), SWAPu32(HW_DMA##n##_BCR), SWAPu32(HW_DMA##n##_CHCR)); \
+	} \
+}
 
-		case 0x1f801820: hard = mdecRead0(); break;
-		case 0x1f801824: hard = mdecRead1(); break;
+#define DMA_CHCR(n) \
+static void hwWrite32Dma##n(u32 add, u32 value) DmaExec(n)
 
-#ifdef PSXHW_LOG
-		case 0x1f8010a0:
-			PSXHW_LOG("DMA2 MADR 32bit read %x\n", psxHu32(0x10a0));
-			return SWAPu32(HW_DMA2_MADR);
-		case 0x1f8010a4:
-			PSXHW_LOG("DMA2 BCR 32bit read %x\n", psxHu32(0x10a4));
-			return SWAPu32(HW_DMA2_BCR);
-		case 0x1f8010a8:
-			PSXHW_LOG("DMA2 CHCR 32bit read %x\n", psxHu32(0x10a8));
-			return SWAPu32(HW_DMA2_CHCR);
-#endif
+DMA_CHCR(0)		// MDEC in DMA
+DMA_CHCR(1)		// MDEC out DMA
+DMA_CHCR(2)		// GPU DMA
+DMA_CHCR(3)		// CDROM DMA
+DMA_CHCR(4)		// SPU DMA
+DMA_CHCR(6)		// OT clear
 
-#ifdef PSXHW_LOG
-		case 0x1f8010b0:
-			PSXHW_LOG("DMA3 MADR 32bit read %x\n", psxHu32(0x10b0));
-			return SWAPu32(HW_DMA3_MADR);
-		case 0x1f8010b4:
-			PSXHW_LOG("DMA3 BCR 32bit read %x\n", psxHu32(0x10b4));
-			return SWAPu32(HW_DMA3_BCR);
-		case 0x1f8010b8:
-			PSXHW_LOG("DMA3 CHCR 32bit read %x\n", psxHu32(0x10b8));
-			return SWAPu32(HW_DMA3_CHCR);
-#endif
+static void hwWrite32DmaIcr(u32 add, u32 value) {
+	u32 tmp = (~value) & SWAPu32(HW_DMA_ICR);
+	HW_DMA_ICR = SWAPu32(((tmp ^ value) & 0xffffff) ^ tmp);
+}
 
-#ifdef PSXHW_LOG
-/*		case 0x1f8010f0:
-			PSXHW_LOG("DMA PCR 32bit read %x\n", psxHu32(0x10f0));
-			return SWAPu32(HW_DMA_PCR); // dma rest channel
-		case 0x1f8010f4:
-			PSXHW_LOG("DMA ICR 32bit read %x\n", psxHu32(0x10f4));
-			return SWAPu32(HW_DMA_ICR); // interrupt enabler?*/
-#endif
+/* Root counters, 0x1f801100 + 0x10 * n: count, mode, target */
 
-		// time for rootcounters :)
-		case 0x1f801100:
-			hard = psxRcntRcount(0);
-#ifdef PSXHW_LOG
-			PSXHW_LOG("T0 count read32: %x\n", hard);
-#endif
-			return hard;
-		case 0x1f801104:
-			hard = psxRcntRmode(0);
-#ifdef PSXHW_LOG
-			PSXHW_LOG("T0 mode read32: %x\n", hard);
-#endif
-			return hard;
-		case 0x1f801108:
-			hard = psxRcntRtarget(0);
-#ifdef PSXHW_LOG
-			PSXHW_LOG("T0 target read32: %x\n", hard);
-#endif
-			return hard;
-		case 0x1f801110:
-			hard = psxRcntRcount(1);
-#ifdef PSXHW_LOG
-			PSXHW_LOG("T1 count read32: %x\n", hard);
-#endif
-			return hard;
-		case 0x1f801114:
-			hard = psxRcntRmode(1);
-#ifdef PSXHW_LOG
-			PSXHW_LOG("T1 mode read32: %x\n", hard);
-#endif
-			return hard;
-		case 0x1f801118:
-			hard = psxRcntRtarget(1);
-#ifdef PSXHW_LOG
-			PSXHW_LOG("T1 target read32: %x\n", hard);
-#endif
-			return hard;
-		case 0x1f801120:
-			hard = psxRcntRcount(2);
-#ifdef PSXHW_LOG
-			PSXHW_LOG("T2 count read32: %x\n", hard);
-#endif
-			return hard;
-		case 0x1f801124:
-			hard = psxRcntRmode(2);
-#ifdef PSXHW_LOG
-			PSXHW_LOG("T2 mode read32: %x\n", hard);
-#endif
-			return hard;
-		case 0x1f801128:
-			hard = psxRcntRtarget(2);
-#ifdef PSXHW_LOG
-			PSXHW_LOG("T2 target read32: %x\n", hard);
-#endif
-			return hard;
+static u16 hwRead16Rcnt(u32 add) {
+	u32 index = (add >> 4) & 3;
 
-		default:
-			hard = psxHu32(add); 
-#ifdef PSXHW_LOG
-			PSXHW_LOG("*Unkwnown 32bit read at address %x\n", add);
-#endif
-			return hard;
+	switch (add & 0xf) {
+		case 0x0: return psxRcntRcount(index);
+		case 0x4: return psxRcntRmode(index);
+		case 0x8: return psxRcntRtarget(index);
 	}
-#ifdef PSXHW_LOG
-	PSXHW_LOG("*Known 32bit read at address %x\n", add);
-#endif
-	return hard;
+	return psxHu16(add);
 }
 
-void psxHwWrite8(u32 add, u8 value) {
-	switch (add) {
-		case 0x1f801040: sioWrite8(value); break;
-#ifdef ENABLE_SIO1API
-		case 0x1f801050: SIO1_writeData8(value); break;
-#endif
-		case 0x1f801800: cdrWrite0(value); break;
-		case 0x1f801801: cdrWrite1(value); break;
-		case 0x1f801802: cdrWrite2(value); break;
-		case 0x1f801803: cdrWrite3(value); break;
+static u32 hwRead32Rcnt(u32 add) {
+	u32 index = (add >> 4) & 3;
 
-		default:
-			psxHu8ref(add) = value;
-#ifdef PSXHW_LOG
-			PSXHW_LOG("*Unknown 8bit write at address %x value %x\n", add, value);
-#endif
-			return;
+	switch (add & 0xf) {
+		case 0x0: return psxRcntRcount(index);
+		case 0x4: return psxRcntRmode(index);
+		case 0x8: return psxRcntRtarget(index);
 	}
+	return psxHu32(add);
+}
+
+static void hwWrite16Rcnt(u32 add, u16 value) {
+	u32 index = (add >> 4) & 3;
+
+	switch (add & 0xf) {
+		case 0x0: psxRcntWcount(index, value); return;
+		case 0x4: psxRcntWmode(index, value); return;
+		case 0x8: psxRcntWtarget(index, value); return;
+	}
+	psxHu16ref(add) = SWAPu16(value);
+}
+
+static void hwWrite32Rcnt(u32 add, u32 value) {
+	u32 index = (add >> 4) & 3;
+
+	switch (add & 0xf) {
+		case 0x0: psxRcntWcount(index, value & 0xffff); return;
+		case 0x4: psxRcntWmode(index, value); return;
+		case 0x8: psxRcntWtarget(index, value & 0xffff); return;
+	}
+	psxHu32ref(add) = SWAPu32(value);
+}
+
+/* CD-ROM, one register per byte lane */
+
+static unsigned char (*cdrRead[4])(void) = { cdrRead0, cdrRead1, cdrRead2, cdrRead3 };
+static void (*cdrWrite[4])(unsigned char value) = { cdrWrite0, cdrWrite1, cdrWrite2, cdrWrite3 };
+
+static u8 hwRead8Cdr(u32 add) {
+	return cdrRead[add & 3]();
+}
+
+static void hwWrite8Cdr(u32 add, u8 value) {
+	cdrWrite[add & 3](value);
 	psxHu8ref(add) = value;
-#ifdef PSXHW_LOG
-	PSXHW_LOG("*Known 8bit write at address %x value %x\n", add, value);
-#endif
 }
 
-void psxHwWrite16(u32 add, u16 value) {
-	switch (add) {
-		case 0x1f801040:
-			sioWrite8((unsigned char)value);
-			sioWrite8((unsigned char)(value>>8));
-#ifdef PAD_LOG
-			PAD_LOG ("sio write16 %x, %x\n", add&0xf, value);
-#endif
-			return;
-		case 0x1f801044:
-			sioWriteStat16(value);
-#ifdef PAD_LOG
-			PAD_LOG ("sio write16 %x, %x\n", add&0xf, value);
-#endif
-			return;
-		case 0x1f801048:
-            sioWriteMode16(value);
-#ifdef PAD_LOG
-			PAD_LOG ("sio write16 %x, %x\n", add&0xf, value);
-#endif
-			return;
-		case 0x1f80104a: // control register
-			sioWriteCtrl16(value);
-#ifdef PAD_LOG
-			PAD_LOG ("sio write16 %x, %x\n", add&0xf, value);
-#endif
-			return;
-		case 0x1f80104e: // baudrate register
-            sioWriteBaud16(value);
-#ifdef PAD_LOG
-			PAD_LOG ("sio write16 %x, %x\n", add&0xf, value);
-#endif
-			return;
-#ifdef ENABLE_SIO1API
-		case 0x1f801050:
-			SIO1_writeData16(value);
-			return;
-		case 0x1f801054:
-			SIO1_writeStat16(value);
-			return;
-		case 0x1f80105a:
-			SIO1_writeCtrl16(value);
-			return;
-		case 0x1f80105e:
-			SIO1_writeBaud16(value);
-			return;
-#endif
-		case 0x1f801070: 
-#ifdef PSXHW_LOG
-			PSXHW_LOG("IREG 16bit write %x\n", value);
-#endif
-			if (Config.Sio) psxHu16ref(0x1070) |= SWAPu16(0x80);
-			if (Config.SpuIrq) psxHu16ref(0x1070) |= SWAPu16(0x200);
-			psxHu16ref(0x1070) &= SWAPu16((psxHu16(0x1074) & value));
-			return;
+/* GPU */
 
-		case 0x1f801074:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("IMASK 16bit write %x\n", value);
-#endif
-			psxHu16ref(0x1074) = SWAPu16(value);
-			return;
+static u32 hwRead32GpuData(u32 add) { return GPU_readData(); }
+static u32 hwRead32GpuStatus(u32 add) { return gpuReadStatus(); }
+static void hwWrite32GpuData(u32 add, u32 value) { GPU_writeData(value); }
+static void hwWrite32GpuStatus(u32 add, u32 value) { GPU_writeStatus(value); }
 
-		case 0x1f801100:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("COUNTER 0 COUNT 16bit write %x\n", value);
-#endif
-			psxRcntWcount(0, value); return;
-		case 0x1f801104:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("COUNTER 0 MODE 16bit write %x\n", value);
-#endif
-			psxRcntWmode(0, value); return;
-		case 0x1f801108:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("COUNTER 0 TARGET 16bit write %x\n", value);
-#endif
-			psxRcntWtarget(0, value); return;
+/* MDEC */
 
-		case 0x1f801110:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("COUNTER 1 COUNT 16bit write %x\n", value);
-#endif
-			psxRcntWcount(1, value); return;
-		case 0x1f801114:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("COUNTER 1 MODE 16bit write %x\n", value);
-#endif
-			psxRcntWmode(1, value); return;
-		case 0x1f801118:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("COUNTER 1 TARGET 16bit write %x\n", value);
-#endif
-			psxRcntWtarget(1, value); return;
+static u32 hwRead32Mdec0(u32 add) { return mdecRead0(); }
+static u32 hwRead32Mdec1(u32 add) { return mdecRead1(); }
 
-		case 0x1f801120:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("COUNTER 2 COUNT 16bit write %x\n", value);
-#endif
-			psxRcntWcount(2, value); return;
-		case 0x1f801124:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("COUNTER 2 MODE 16bit write %x\n", value);
-#endif
-			psxRcntWmode(2, value); return;
-		case 0x1f801128:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("COUNTER 2 TARGET 16bit write %x\n", value);
-#endif
-			psxRcntWtarget(2, value); return;
+static void hwWrite32Mdec0(u32 add, u32 value) {
+	mdecWrite0(value);
+	psxHu32ref(add) = SWAPu32(value);
+}
 
-		default:
-			if (add>=0x1f801c00 && add<0x1f801e00) {
-            	SPU_writeRegister(add, value);
-				return;
-			}
+static void hwWrite32Mdec1(u32 add, u32 value) {
+	mdecWrite1(value);
+	psxHu32ref(add) = SWAPu32(value);
+}
 
-			psxHu16ref(add) = SWAPu16(value);
-#ifdef PSXHW_LOG
-			PSXHW_LOG("*Unknown 16bit write at address %x value %x\n", add, value);
-#endif
-			return;
-	}
-	psxHu16ref(add) = SWAPu16(value);
-#ifdef PSXHW_LOG
-	PSXHW_LOG("*Known 16bit write at address %x value %x\n", add, value);
-#endif
+/* SPU */
+
+static u16 hwRead16Spu(u32 add) {
+	return SPU_readRegister(add);
 }
 
-#define DmaExec(n) { \
-	HW_DMA##n##_CHCR = SWAPu32(value); \
-\
-	if (SWAPu32(HW_DMA##n##_CHCR) & 0x01000000 && SWAPu32(HW_DMA_PCR) & (8 << (n * 4))) { \
-		psxDma##n(SWAPu32(HW_DMA##n##_MADR), SWAPu32(HW_DMA##n##_BCR), SWAPu32(HW_DMA##n##_CHCR)); \
-	} \
+static void hwWrite16Spu(u32 add, u16 value) {
+	SPU_writeRegister(add, value);
 }
 
-void psxHwWrite32(u32 add, u32 value) {
-	switch (add) {
-	    case 0x1f801040:
-			sioWrite8((unsigned char)value);
-			sioWrite8((unsigned char)((value&0xff) >>  8));
-			sioWrite8((unsigned char)((value&0xff) >> 16));
-			sioWrite8((unsigned char)((value&0xff) >> 24));
-#ifdef PAD_LOG
-			PAD_LOG("sio write32 %x\n", value);
-#endif
-			return;
+// Dukes of Hazard 2 - car engine noise
+static void hwWrite32Spu(u32 add, u32 value) {
+	SPU_writeRegister(add, value&0xffff);
+
+	add += 2;
+	value >>= 16;
+
+	if (add>=0x1f801c00 && add<0x1f801e00)
+		SPU_writeRegister(add, value&0xffff);
+}
+
+static void psxHwMap8(u32 add, psxHwRead8Func r, psxHwWrite8Func w) {
+	hwRead8[(add - HW_BASE) >> 2] = r;
+	hwWrite8[(add - HW_BASE) >> 2] = w;
+}
+
+static void psxHwMap16(u32 add, psxHwRead16Func r, psxHwWrite16Func w) {
+	if (r) hwRead16[(add - HW_BASE) >> 1] = r;
+	if (w) hwWrite16[(add - HW_BASE) >> 1] = w;
+}
+
+static void psxHwMap32(u32 add, psxHwRead32Func r, psxHwWrite32Func w) {
+	if (r) hwRead32[(add - HW_BASE) >> 2] = r;
+	if (w) hwWrite32[(add - HW_BASE) >> 2] = w;
+}
+
+static void psxHwMapInit() {
+	u32 add;
+	int i;
+
+	for (i = 0; i < (HW_SIZE >> 2); i++) {
+		hwRead8[i] = hwRead8Mem;
+		hwRead32[i] = hwRead32Mem;
+		hwWrite8[i] = hwWrite8Mem;
+		hwWrite32[i] = hwWrite32Mem;
+	}
+	for (i = 0; i < (HW_SIZE >> 1); i++) {
+		hwRead16[i] = hwRead16Mem;
+		hwWrite16[i] = hwWrite16Mem;
+	}
+
+	psxHwMap8(0x1f801040, hwRead8Sio, hwWrite8Sio);
+	psxHwMap8(0x1f801800, hwRead8Cdr, hwWrite8Cdr);
+	for (add = 0x1f801040; add < 0x1f801050; add += 2)
+		psxHwMap16(add, hwRead16Sio, hwWrite16Sio);
+	psxHwMap32(0x1f801040, hwRead32Sio, hwWrite32Sio);
 #ifdef ENABLE_SIO1API
-		case 0x1f801050:
-			SIO1_writeData32(value);
-			return;
-#endif
-#ifdef PSXHW_LOG
-		case 0x1f801060:
-			PSXHW_LOG("RAM size write %x\n", value);
-			psxHu32ref(add) = SWAPu32(value);
-			return; // Ram size
-#endif
+	psxHwMap8(0x1f801050, hwRead8Sio1, hwWrite8Sio1);
+	for (add = 0x1f801050; add < 0x1f801060; add += 2)
+		psxHwMap16(add, hwRead16Sio1, hwWrite16Sio1);
+	psxHwMap32(0x1f801050, hwRead32Sio1, hwWrite32Sio1);
+#endif
+
+	psxHwMap16(0x1f801070, NULL, hwWrite16Ireg);
+	psxHwMap32(0x1f801070, NULL, hwWrite32Ireg);
+
+	psxHwMap32(0x1f801088, NULL, hwWrite32Dma0);
+	psxHwMap32(0x1f801098, NULL, hwWrite32Dma1);
+	psxHwMap32(0x1f8010a8, NULL, hwWrite32Dma2);
+	psxHwMap32(0x1f8010b8, NULL, hwWrite32Dma3);
+	psxHwMap32(0x1f8010c8, NULL, hwWrite32Dma4);
+	psxHwMap32(0x1f8010e8, NULL, hwWrite32Dma6);
+	psxHwMap32(0x1f8010f4, NULL, hwWrite32DmaIcr);
+
+	for (i = 0; i < 3; i++) {
+		for (add = 0x1f801100 + i * 0x10; add < 0x1f80110c + i * 0x10; add += 4) {
+			psxHwMap16(add, hwRead16Rcnt, hwWrite16Rcnt);
+			psxHwMap32(add, hwRead32Rcnt, hwWrite32Rcnt);
+		}
+	}
 
-		case 0x1f801070: 
-#ifdef PSXHW_LOG
-			PSXHW_LOG("IREG 32bit write %x\n", value);
-#endif
-			if (Config.Sio) psxHu32ref(0x1070) |= SWAPu32(0x80);
-			if (Config.SpuIrq) psxHu32ref(0x1070) |= SWAPu32(0x200);
-			psxHu32ref(0x1070) &= SWAPu32((psxHu32(0x1074) & value));
-			return;
-		case 0x1f801074:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("IMASK 32bit write %x\n", value);
-#endif
-			psxHu32ref(0x1074) = SWAPu32(value);
-			return;
+	psxHwMap32(0x1f801810, hwRead32GpuData, hwWrite32GpuData);
+	psxHwMap32(0x1f801814, hwRead32GpuStatus, hwWrite32GpuStatus);
+	psxHwMap32(0x1f801820, hwRead32Mdec0, hwWrite32Mdec0);
+	psxHwMap32(0x1f801824, hwRead32Mdec1, hwWrite32Mdec1);
 
-#ifdef PSXHW_LOG
-		case 0x1f801080:
-			PSXHW_LOG("DMA0 MADR 32bit write %x\n", value);
-			HW_DMA0_MADR = SWAPu32(value); return; // DMA0 madr
-		case 0x1f801084:
-			PSXHW_LOG("DMA0 BCR 32bit write %x\n", value);
-			HW_DMA0_BCR  = SWAPu32(value); return; // DMA0 bcr
-#endif
-		case 0x1f801088:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("DMA0 CHCR 32bit write %x\n", value);
-#endif
-			DmaExec(0);	                 // DMA0 chcr (MDEC in DMA)
-			return;
+	for (add = 0x1f801c00; add < 0x1f801e00; add += 2) {
+		psxHwMap16(add, hwRead16Spu, hwWrite16Spu);
+		if (!(add & 3))
+			psxHwMap32(add, NULL, hwWrite32Spu);
+	}
+}
 
-#ifdef PSXHW_LOG
-		case 0x1f801090:
-			PSXHW_LOG("DMA1 MADR 32bit write %x\n", value);
-			HW_DMA1_MADR = SWAPu32(value); return; // DMA1 madr
-		case 0x1f801094:
-			PSXHW_LOG("DMA1 BCR 32bit write %x\n", value);
-			HW_DMA1_BCR  = SWAPu32(value); return; // DMA1 bcr
-#endif
-		case 0x1f801098:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("DMA1 CHCR 32bit write %x\n", value);
-#endif
-			DmaExec(1);                  // DMA1 chcr (MDEC out DMA)
-			return;
+void psxHwReset() {
+	if (Config.Sio) psxHu32ref(0x1070) |= SWAP32(0x80);
+	if (Config.SpuIrq) psxHu32ref(0x1070) |= SWAP32(0x200);
 
-#ifdef PSXHW_LOG
-		case 0x1f8010a0:
-			PSXHW_LOG("DMA2 MADR 32bit write %x\n", value);
-			HW_DMA2_MADR = SWAPu32(value); return; // DMA2 madr
-		case 0x1f8010a4:
-			PSXHW_LOG("DMA2 BCR 32bit write %x\n", value);
-			HW_DMA2_BCR  = SWAPu32(value); return; // DMA2 bcr
-#endif
-		case 0x1f8010a8:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("DMA2 CHCR 32bit write %x\n", value);
-#endif
-			DmaExec(2);                  // DMA2 chcr (GPU DMA)
-			return;
+	memset(psxH, 0, 0x10000);
 
-#ifdef PSXHW_LOG
-		case 0x1f8010b0:
-			PSXHW_LOG("DMA3 MADR 32bit write %x\n", value);
-			HW_DMA3_MADR = SWAPu32(value); return; // DMA3 madr
-		case 0x1f8010b4:
-			PSXHW_LOG("DMA3 BCR 32bit write %x\n", value);
-			HW_DMA3_BCR  = SWAPu32(value); return; // DMA3 bcr
-#endif
-		case 0x1f8010b8:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("DMA3 CHCR 32bit write %x\n", value);
-#endif
-			DmaExec(3);                  // DMA3 chcr (CDROM DMA)
-			
-			return;
+	psxHwMapInit();
 
-#ifdef PSXHW_LOG
-		case 0x1f8010c0:
-			PSXHW_LOG("DMA4 MADR 32bit write %x\n", value);
-			HW_DMA4_MADR = SWAPu32(value); return; // DMA4 madr
-		case 0x1f8010c4:
-			PSXHW_LOG("DMA4 BCR 32bit write %x\n", value);
-			HW_DMA4_BCR  = SWAPu32(value); return; // DMA4 bcr
-#endif
-		case 0x1f8010c8:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("DMA4 CHCR 32bit write %x\n", value);
-#endif
-			DmaExec(4);                  // DMA4 chcr (SPU DMA)
-			return;
+	mdecInit(); // initialize mdec decoder
+	cdrReset();
+	psxRcntInit();
+}
 
-#if 0
-		case 0x1f8010d0: break; //DMA5write_madr();
-		case 0x1f8010d4: break; //DMA5write_bcr();
-		case 0x1f8010d8: break; //DMA5write_chcr(); // Not needed
-#endif
+u8 psxHwRead8(u32 add) {
+	u32 offset = add - HW_BASE;
+	u8 hard;
 
+	PSXPROF_HW_READ(offset);
+	hard = (offset < HW_SIZE) ? hwRead8[offset >> 2](add) : psxHu8(add);
 #ifdef PSXHW_LOG
-		case 0x1f8010e0:
-			PSXHW_LOG("DMA6 MADR 32bit write %x\n", value);
-			HW_DMA6_MADR = SWAPu32(value); return; // DMA6 bcr
-		case 0x1f8010e4:
-			PSXHW_LOG("DMA6 BCR 32bit write %x\n", value);
-			HW_DMA6_BCR  = SWAPu32(value); return; // DMA6 bcr
+	PSXHW_LOG("8bit read at address %x value %x\n", add, hard);
 #endif
-		case 0x1f8010e8:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("DMA6 CHCR 32bit write %x\n", value);
-#endif
-			DmaExec(6);                   // DMA6 chcr (OT clear)
-			return;
+	return hard;
+}
 
-#ifdef PSXHW_LOG
-		case 0x1f8010f0:
-			PSXHW_LOG("DMA PCR 32bit write %x\n", value);
-			HW_DMA_PCR = SWAPu32(value);
-			return;
-#endif
+u16 psxHwRead16(u32 add) {
+	u32 offset = add - HW_BASE;
+	u16 hard;
 
-		case 0x1f8010f4:
+	PSXPROF_HW_READ(offset);
+	hard = (offset < HW_SIZE) ? hwRead16[offset >> 1](add) : psxHu16(add);
 #ifdef PSXHW_LOG
-			PSXHW_LOG("DMA ICR 32bit write %x\n", value);
+	PSXHW_LOG("16bit read at address %x value %x\n", add, hard);
 #endif
-		{
-			u32 tmp = (~value) & SWAPu32(HW_DMA_ICR);
-			HW_DMA_ICR = SWAPu32(((tmp ^ value) & 0xffffff) ^ tmp);
-			return;
-		}
+	return hard;
+}
 
-		case 0x1f801810:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("GPU DATA 32bit write %x\n", value);
-#endif
-			GPU_writeData(value); return;
-		case 0x1f801814:
+u32 psxHwRead32(u32 add) {
+	u32 offset = add - HW_BASE;
+	u32 hard;
+
+	PSXPROF_HW_READ(offset);
+	hard = (offset < HW_SIZE) ? hwRead32[offset >> 2](add) : psxHu32(add);
 #ifdef PSXHW_LOG
-			PSXHW_LOG("GPU STATUS 32bit write %x\n", value);
+	PSXHW_LOG("32bit read at address %x value %x\n", add, hard);
 #endif
-			GPU_writeStatus(value); return;
+	return hard;
+}
 
-		case 0x1f801820:
-			mdecWrite0(value); break;
-		case 0x1f801824:
-			mdecWrite1(value); break;
+void psxHwWrite8(u32 add, u8 value) {
+	u32 offset = add - HW_BASE;
 
-		case 0x1f801100:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("COUNTER 0 COUNT 32bit write %x\n", value);
-#endif
-			psxRcntWcount(0, value & 0xffff); return;
-		case 0x1f801104:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("COUNTER 0 MODE 32bit write %x\n", value);
-#endif
-			psxRcntWmode(0, value); return;
-		case 0x1f801108:
+	PSXPROF_HW_WRITE(offset);
 #ifdef PSXHW_LOG
-			PSXHW_LOG("COUNTER 0 TARGET 32bit write %x\n", value);
+	PSXHW_LOG("8bit write at address %x value %x\n", add, value);
 #endif
-			psxRcntWtarget(0, value & 0xffff); return; //  HW_DMA_ICR&= SWAP32((~value)&0xff000000);
+	if (offset < HW_SIZE)
+		hwWrite8[offset >> 2](add, value);
+	else
+		psxHu8ref(add) = value;
+}
 
-		case 0x1f801110:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("COUNTER 1 COUNT 32bit write %x\n", value);
-#endif
-			psxRcntWcount(1, value & 0xffff); return;
-		case 0x1f801114:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("COUNTER 1 MODE 32bit write %x\n", value);
-#endif
-			psxRcntWmode(1, value); return;
-		case 0x1f801118:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("COUNTER 1 TARGET 32bit write %x\n", value);
-#endif
-			psxRcntWtarget(1, value & 0xffff); return;
+void psxHwWrite16(u32 add, u16 value) {
+	u32 offset = add - HW_BASE;
 
-		case 0x1f801120:
+	PSXPROF_HW_WRITE(offset);
 #ifdef PSXHW_LOG
-			PSXHW_LOG("COUNTER 2 COUNT 32bit write %x\n", value);
+	PSXHW_LOG("16bit write at address %x value %x\n", add, value);
 #endif
-			psxRcntWcount(2, value & 0xffff); return;
-		case 0x1f801124:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("COUNTER 2 MODE 32bit write %x\n", value);
-#endif
-			psxRcntWmode(2, value); return;
-		case 0x1f801128:
-#ifdef PSXHW_LOG
-			PSXHW_LOG("COUNTER 2 TARGET 32bit write %x\n", value);
-#endif
-			psxRcntWtarget(2, value & 0xffff); return;
+	if (offset < HW_SIZE)
+		hwWrite16[offset >> 1](add, value);
+	else
+		psxHu16ref(add) = SWAPu16(value);
+}
 
-		default:
-			// Dukes of Hazard 2 - car engine noise
-			if (add>=0x1f801c00 && add<0x1f801e00) {
-        SPU_writeRegister(add, value&0xffff);
-				
-				add += 2;
-				value >>= 16;
-
-				if (add>=0x1f801c00 && add<0x1f801e00)
-					SPU_writeRegister(add, value&0xffff);
-				return;
-			}
-
-
-			psxHu32ref(add) = SWAPu32(value);
-#ifdef PSXHW_LOG
-			PSXHW_LOG("*Unknown 32bit write at address %x value %x\n", add, value);
-#endif
-			return;
-	}
-	psxHu32ref(add) = SWAPu32(value);
+void psxHwWrite32(u32 add, u32 value) {
+	u32 offset = add - HW_BASE;
+
+	PSXPROF_HW_WRITE(offset);
 #ifdef PSXHW_LOG
-	PSXHW_LOG("*Known 32bit write at address %x value %x\n", add, value);
+	PSXHW_LOG("32bit write at address %x value %x\n", add, value);
 #endif
+	if (offset < HW_SIZE)
+		hwWrite32[offset >> 2](add, value);
+	else
+		psxHu32ref(add) = SWAPu32(value);
 }
 
-int psxHwFreeze(gzFile f, int Mode) {
+int psxHwFreeze(FreezeBuf *f, int Mode) {
 	return 0;
 }
@@ -29,6 +29,7 @@ extern "C" {
 #include "psxmem.h"
 #include "sio.h"
 #include "psxcounters.h"
+#include "psxtrace.h"
 
 #define HW_DMA0_MADR (psxHu32ref(0x1080)) // MDEC in DMA
 #define HW_DMA0_BCR  (psxHu32ref(0x1084))
@@ -57,11 +58,13 @@ extern "C" {
 #define HW_DMA_PCR   (psxHu32ref(0x10f0))
 #define HW_DMA_ICR   (psxHu32ref(0x10f4))
 
-#define	DMA_INTERRUPT(n) \
+#define	DMA_INTERRUPT(n) do { \
+	PSXTRACE(PSXTRACE_DMA_IRQ, n, 0, 0);            \
 	if (SWAPu32(HW_DMA_ICR) & (1 << (16 + n))) {    \
 		HW_DMA_ICR |= SWAP32(1 << (24 + n));        \
 		psxHu32ref(0x1070) |= SWAP32(8);            \
-	}
+	} \
+} while (0)
 
 void psxHwReset();
 u8 psxHwRead8(u32 add);
@@ -70,7 +73,7 @@ u32 psxHwRead32(u32 add);
 void psxHwWrite8(u32 add, u8  value);
 void psxHwWrite16(u32 add, u16 value);
 void psxHwWrite32(u32 add, u32 value);
-int psxHwFreeze(gzFile f, int Mode);
+int psxHwFreeze(FreezeBuf *f, int Mode);
 
 #ifdef __cplusplus
 }
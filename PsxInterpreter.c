@@ -41,6 +41,15 @@ extern int stop;
 
 void execI();
 
+// psxCpuCycles is in 1/16 cycles, carry the remainder over
+static u32 cycleFrac = 0;
+
+static __inline void addCycles() {
+	cycleFrac += psxCpuCycles;
+	psxCore.cycle += cycleFrac >> 4;
+	cycleFrac &= 15;
+}
+
 // Subsets
 void (*psxBSC[64])();
 void (*psxSPC[64])();
@@ -360,7 +369,7 @@ static int psxDelayBranchExec(u32 tar) {
 
 	branch = 0;
 	psxCore.pc = tar;
-	psxCore.cycle += BIAS;
+	addCycles();
 	psxBranchTest();
 	return 1;
 }
@@ -386,7 +395,7 @@ static int psxDelayBranchTest(u32 tar1) {
 		return psxDelayBranchExec(tar2);
 	}
 	debugI();
-	psxCore.cycle += BIAS;
+	addCycles();
 
 	/*
 	 * Got a branch at tar1:
@@ -399,7 +408,7 @@ static int psxDelayBranchTest(u32 tar1) {
 		return psxDelayBranchExec(tmp1);
 	}
 	debugI();
-	psxCore.cycle += BIAS;
+	addCycles();
 
 	/*
 	 * Got a branch at tar2:
@@ -411,6 +420,7 @@ static int psxDelayBranchTest(u32 tar1) {
 }
 
 static __inline void doBranch(u32 tar) {
+	u32 bpc = psxCore.pc - 4;
 	u32 *code;
 	u32 tmp;
 
@@ -429,7 +439,7 @@ static __inline void doBranch(u32 tar) {
 	debugI();
 
 	psxCore.pc += 4;
-	psxCore.cycle += BIAS;
+	addCycles();
 
 	// check for load delay
 	tmp = psxCore.code >> 26;
@@ -470,6 +480,9 @@ static __inline void doBranch(u32 tar) {
 	branch = 0;
 	psxCore.pc = branchPC;
 
+	if (branchPC <= bpc)
+		psxIdleSkip(bpc);
+
 	psxBranchTest();
 }
 
@@ -1097,7 +1110,7 @@ void execI() {
 	//if (Config.Debug) ProcessDebug();
 
 	psxCore.pc += 4;
-	psxCore.cycle += BIAS;
+	addCycles();
 
 	psxBSC[psxCore.code >> 26]();
 }
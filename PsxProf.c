@@ -0,0 +1,194 @@
+/***************************************************************************
+ *   PsxProf.c - guest hot-spot profiler                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02111-1307 USA.           *
+ ***************************************************************************/
+
+/*
+* Guest hot-spot profiler.
+*
+* psxBranchTest samples the PC every psxProf.interval cycles into an open
+* addressed histogram. Both the interpreter and the dynarec pass through it
+* at block boundaries, so the samples land on the starts of the blocks the
+* time is spent in. BIOS calls are counted where they are dispatched (the
+* HLE stubs, or psxJumpTest with a real BIOS) and hardware registers in the
+* psxHw accessors.
+*
+* With a real BIOS the dynarec only calls psxJumpTest from blocks compiled
+* while profiling is on, so start profiling before the game boots.
+*/
+
+#include "psxprof.h"
+#include "r3000a.h"
+#include "psxbios.h"
+#include "coredebug.h"
+
+#define PROF_SLOTS	4096	// power of 2
+#define PROF_PROBE	16
+#define PROF_BLOCK	12		// most instructions disassembled per hot block
+
+typedef struct {
+	u32 pc;
+	u32 count;
+} ProfSlot;
+
+PsxProf psxProf;
+
+static ProfSlot profSlots[PROF_SLOTS];
+static u32 profSamples;
+static u32 profDropped;
+
+void PsxProfStart(u32 interval) {
+	memset(&psxProf, 0, sizeof(psxProf));
+	memset(profSlots, 0, sizeof(profSlots));
+	profSamples = profDropped = 0;
+
+	psxProf.interval = interval ? interval : 1;
+	psxProf.nextSample = psxCore.cycle + psxProf.interval;
+	psxProf.enabled = TRUE;
+}
+
+void PsxProfStop() {
+	psxProf.enabled = FALSE;
+}
+
+void PsxProfSample() {
+	u32 pc = psxCore.pc;
+	u32 h = ((pc >> 2) * 2654435761u) >> 20;
+	// A block or a skipped idle loop may run past several sample points
+	u32 weight = (psxCore.cycle - psxProf.nextSample) / psxProf.interval + 1;
+	int i;
+
+	psxProf.nextSample = psxCore.cycle + psxProf.interval;
+	profSamples += weight;
+
+	for (i = 0; i < PROF_PROBE; i++) {
+		ProfSlot *s = &profSlots[(h + i) & (PROF_SLOTS - 1)];
+
+		if (s->count && s->pc != pc) continue;
+		s->pc = pc;
+		s->count += weight;
+		return;
+	}
+	profDropped += weight;
+}
+
+//============================================
+//===  REPORT
+//============================================
+
+typedef struct {
+	u32 key;
+	u32 count;
+} ProfEntry;
+
+static int ProfCompare(const void *a, const void *b) {
+	u32 ca = ((const ProfEntry *)a)->count, cb = ((const ProfEntry *)b)->count;
+
+	return ca < cb ? 1 : ca > cb ? -1 : 0;
+}
+
+// Sorts the non-zero counters and returns how many there were
+static int ProfSort(ProfEntry *entries, const u32 *counts, int n) {
+	int i, used = 0;
+
+	for (i = 0; i < n; i++) {
+		if (!counts[i]) continue;
+		entries[used].key = i;
+		entries[used].count = counts[i];
+		used++;
+	}
+	qsort(entries, used, sizeof(ProfEntry), ProfCompare);
+	return used;
+}
+
+static boolean ProfIsBranch(u32 code) {
+	switch (code >> 26) {
+		case 0x00: return (code & 0x3e) == 0x08;	// JR, JALR
+		case 0x01: case 0x02: case 0x03: case 0x04:
+		case 0x05: case 0x06: case 0x07: return TRUE;
+	}
+	return FALSE;
+}
+
+static void ProfDisasm(FILE *f, u32 pc) {
+	int i;
+
+	for (i = 0; i < PROF_BLOCK; i++, pc += 4) {
+		u32 code;
+
+		if (PSXM(pc) == NULL) return;
+		code = PSXMu32(pc);
+		fprintf(f, "\t\t%s\n", disR3000AF(code, pc));
+		if (ProfIsBranch(code)) {
+			pc += 4;
+			if (PSXM(pc) != NULL)
+				fprintf(f, "\t\t%s\n", disR3000AF(PSXMu32(pc), pc));
+			return;
+		}
+	}
+}
+
+void PsxProfDump(FILE *f, int top) {
+	static const char *tables[3] = { "A0", "B0", "C0" };
+	static char *const *names[3] = { biosA0n, biosB0n, biosC0n };
+	ProfEntry *entries = (ProfEntry *)malloc(sizeof(ProfEntry) * PROF_SLOTS);
+	static u32 counts[PROF_SLOTS];
+	int i, n, t;
+
+	if (entries == NULL) return;
+
+	// Hot blocks
+	for (i = 0; i < PROF_SLOTS; i++)
+		counts[i] = profSlots[i].count;
+	n = ProfSort(entries, counts, PROF_SLOTS);
+	fprintf(f, "%u PC samples every %u cycles (%u dropped)\n", profSamples, psxProf.interval, profDropped);
+	for (i = 0; i < n && i < top; i++) {
+		u32 pc = profSlots[entries[i].key].pc;
+
+		fprintf(f, "  %8.8x %8u %5.1f%%\n", pc, entries[i].count,
+			profSamples ? 100.0 * entries[i].count / profSamples : 0);
+		ProfDisasm(f, pc);
+	}
+
+	// BIOS calls
+	fprintf(f, "BIOS calls\n");
+	for (t = 0; t < 3; t++) {
+		n = ProfSort(entries, psxProf.bios[t], 256);
+		for (i = 0; i < n && i < top; i++) {
+			const char *name = names[t][entries[i].key];
+			fprintf(f, "  %s:%2.2x %-20s %8u\n", tables[t], entries[i].key,
+				name ? name : "?", entries[i].count);
+		}
+	}
+
+	// Hardware registers
+	fprintf(f, "Hardware register reads\n");
+	n = ProfSort(entries, psxProf.hwRead, PSXPROF_HW_SIZE >> 1);
+	for (i = 0; i < n && i < top; i++)
+		fprintf(f, "  %8.8x %8u\n", 0x1f801000 + entries[i].key * 2, entries[i].count);
+	fprintf(f, "Hardware register writes\n");
+	n = ProfSort(entries, psxProf.hwWrite, PSXPROF_HW_SIZE >> 1);
+	for (i = 0; i < n && i < top; i++)
+		fprintf(f, "  %8.8x %8u\n", 0x1f801000 + entries[i].key * 2, entries[i].count);
+
+	fprintf(f, "DMA transfers\n");
+	for (i = 0; i < 7; i++)
+		if (psxProf.dma[i])
+			fprintf(f, "  channel %d %8u\n", i, psxProf.dma[i]);
+
+	free(entries);
+}
@@ -0,0 +1,73 @@
+/***************************************************************************
+ *   PsxProf.h - guest hot-spot profiler                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02111-1307 USA.           *
+ ***************************************************************************/
+
+#ifndef __PSXPROF_H__
+#define __PSXPROF_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "psxcommon.h"
+
+#define PSXPROF_HW_SIZE		0x1000	// same window as the psxHw dispatch tables
+
+typedef struct {
+	boolean enabled;
+	u32 interval;				// cycles between PC samples
+	u32 nextSample;
+	u32 bios[3][256];			// A0, B0, C0 calls
+	u32 hwRead[PSXPROF_HW_SIZE >> 1];	// per halfword of 0x1f801000-0x1f801fff
+	u32 hwWrite[PSXPROF_HW_SIZE >> 1];
+	u32 dma[7];					// transfers started per channel
+} PsxProf;
+
+extern PsxProf psxProf;
+
+void PsxProfStart(u32 interval);
+void PsxProfStop();
+void PsxProfSample();
+void PsxProfDump(FILE *f, int top);
+
+// Hooks for the core, cheap enough to leave in while profiling is off
+
+#define PSXPROF_SAMPLE() do { \
+	if (psxProf.enabled && (s32)(psxCore.cycle - psxProf.nextSample) >= 0) PsxProfSample(); \
+} while (0)
+
+#define PSXPROF_BIOS(table, call) do { \
+	if (psxProf.enabled) psxProf.bios[table][(call) & 0xff]++; \
+} while (0)
+
+#define PSXPROF_HW_READ(offset) do { \
+	if (psxProf.enabled && (offset) < PSXPROF_HW_SIZE) psxProf.hwRead[(offset) >> 1]++; \
+} while (0)
+
+#define PSXPROF_HW_WRITE(offset) do { \
+	if (psxProf.enabled && (offset) < PSXPROF_HW_SIZE) psxProf.hwWrite[(offset) >> 1]++; \
+} while (0)
+
+#define PSXPROF_DMA(n) do { \
+	if (psxProf.enabled) psxProf.dma[n]++; \
+} while (0)
+
+#ifdef __cplusplus
+}
+#endif
+#endif
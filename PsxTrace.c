@@ -0,0 +1,215 @@
+/***************************************************************************
+ *   PsxTrace.c - guest event trace with Chrome export                     *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02111-1307 USA.           *
+ ***************************************************************************/
+
+/*
+* Event trace of interrupts, DMAs, CD-ROM commands and frames.
+*
+* The hooks are always compiled in and cost one flag test while tracing is
+* off. When on, each event goes into a ring of the last PSXTRACE_RING
+* events, stamped with the guest cycle; the GPU and SPU plugin calls also
+* record how long they took on the host.
+*
+* PsxTraceSave() writes the ring as a binary file: the 8-byte magic, the
+* event count, then 16 bytes per event (cycle, type, arg, a, b), all
+* little-endian. PsxTraceConvert() turns such a file into a Chrome trace
+* (chrome://tracing, Perfetto) on the guest timeline: one track per DMA
+* channel with a slice per transfer, frames as slices between updateLace
+* calls, and interrupts, CD-ROM commands and SPU updates as instants.
+*/
+
+#include "psxtrace.h"
+#include "r3000a.h"
+#include <sys/time.h>
+
+#define TRACE_MAGIC		"PSXEVT01"
+
+PsxTraceRing psxTrace;
+
+int PsxTraceStart() {
+	if (psxTrace.ring == NULL) {
+		psxTrace.ring = (PsxTraceEvent *)malloc(sizeof(PsxTraceEvent) * PSXTRACE_RING);
+		if (psxTrace.ring == NULL) return -1;
+	}
+	psxTrace.head = 0;
+	psxTrace.enabled = TRUE;
+	return 0;
+}
+
+void PsxTraceStop() {
+	psxTrace.enabled = FALSE;
+}
+
+u32 PsxTraceUsec() {
+	struct timeval now;
+
+	gettimeofday(&now, NULL);
+	return now.tv_sec * 1000000 + now.tv_usec;
+}
+
+static void Put32(u8 *p, u32 v) {
+	p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+}
+
+static u32 Get32(const u8 *p) {
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((u32)p[3] << 24);
+}
+
+int PsxTraceSave(const char *filename) {
+	u32 n, i;
+	u8 b[16];
+	FILE *f;
+
+	if (psxTrace.ring == NULL) return -1;
+	f = fopen(filename, "wb");
+	if (f == NULL) return -1;
+
+	n = psxTrace.head < PSXTRACE_RING ? psxTrace.head : PSXTRACE_RING;
+	fwrite(TRACE_MAGIC, 1, 8, f);
+	Put32(b, n);
+	fwrite(b, 1, 4, f);
+
+	for (i = psxTrace.head - n; i != psxTrace.head; i++) {
+		PsxTraceEvent *ev = &psxTrace.ring[i & (PSXTRACE_RING - 1)];
+
+		Put32(b, ev->cycle);
+		b[4] = ev->type; b[5] = ev->type >> 8;
+		b[6] = ev->arg; b[7] = ev->arg >> 8;
+		Put32(b + 8, ev->a);
+		Put32(b + 12, ev->b);
+		fwrite(b, 1, 16, f);
+	}
+
+	fclose(f);
+	return 0;
+}
+
+//============================================
+//===  CHROME TRACE
+//============================================
+
+enum {
+	TRACK_CPU = 1,
+	TRACK_FRAMES,
+	TRACK_CDROM,
+	TRACK_SPU,
+	TRACK_DMA				// + channel
+};
+
+static const char *dmaNames[7] = {
+	"DMA0 MDEC in", "DMA1 MDEC out", "DMA2 GPU", "DMA3 CD-ROM",
+	"DMA4 SPU", "DMA5", "DMA6 OT clear"
+};
+
+static void TrackName(FILE *f, int tid, const char *name) {
+	fprintf(f, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,"
+		"\"args\":{\"name\":\"%s\"}},\n", tid, name);
+}
+
+int PsxTraceConvert(const char *filename, const char *jsonname) {
+	double dmaStart[7], frameStart = -1;
+	u32 n, i, frame = 0, last = 0;
+	u64 cycles = 0;
+	FILE *in, *out;
+	u8 b[16];
+
+	in = fopen(filename, "rb");
+	if (in == NULL) return -1;
+	if (fread(b, 1, 12, in) != 12 || memcmp(b, TRACE_MAGIC, 8)) {
+		fclose(in);
+		return -1;
+	}
+	n = Get32(b + 8);
+
+	out = fopen(jsonname, "w");
+	if (out == NULL) {
+		fclose(in);
+		return -1;
+	}
+
+	fprintf(out, "{\"traceEvents\":[\n");
+	TrackName(out, TRACK_CPU, "Exceptions");
+	TrackName(out, TRACK_FRAMES, "Frames");
+	TrackName(out, TRACK_CDROM, "CD-ROM");
+	TrackName(out, TRACK_SPU, "SPU");
+	for (i = 0; i < 7; i++) {
+		TrackName(out, TRACK_DMA + i, dmaNames[i]);
+		dmaStart[i] = -1;
+	}
+
+	for (i = 0; i < n && fread(b, 1, 16, in) == 16; i++) {
+		u32 cycle = Get32(b), a = Get32(b + 8), c = Get32(b + 12);
+		u32 type = b[4] | (b[5] << 8), arg = b[6] | (b[7] << 8);
+		double ts;
+
+		// The ring is in order, so the 32-bit cycle counter only ever
+		// moves forward between events
+		if (i) cycles += (u32)(cycle - last);
+		last = cycle;
+		ts = (double)cycles * 1000000.0 / PSXCLK;
+
+		switch (type) {
+			case PSXTRACE_EXCEPTION:
+				fprintf(out, "{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,"
+					"\"args\":{\"cause\":\"%08x\",\"epc\":\"%08x\",\"irq\":\"%03x\"}},\n",
+					((a >> 2) & 0x1f) == 0 ? "Interrupt" : "Exception", TRACK_CPU, ts, a, c, arg);
+				break;
+
+			case PSXTRACE_DMA_START:
+				if (arg >= 7) break;
+				dmaStart[arg] = ts;
+				fprintf(out, "{\"name\":\"start\",\"ph\":\"i\",\"s\":\"t\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,"
+					"\"args\":{\"madr\":\"%08x\",\"bcr\":\"%08x\"}},\n", TRACK_DMA + arg, ts, a, c);
+				break;
+
+			case PSXTRACE_DMA_IRQ:
+				if (arg < 7 && dmaStart[arg] >= 0) {
+					fprintf(out, "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f},\n",
+						dmaNames[arg], TRACK_DMA + arg, dmaStart[arg], ts - dmaStart[arg]);
+					dmaStart[arg] = -1;
+				}
+				break;
+
+			case PSXTRACE_CDR_IRQ:
+				fprintf(out, "{\"name\":\"cmd %02x\",\"ph\":\"i\",\"s\":\"t\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,"
+					"\"args\":{\"stat\":\"%02x\"}},\n", arg, TRACK_CDROM, ts, a);
+				break;
+
+			case PSXTRACE_UPDATELACE:
+				if (frameStart >= 0)
+					fprintf(out, "{\"name\":\"frame %u\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,"
+						"\"args\":{\"gpu_host_us\":%u}},\n", frame, TRACK_FRAMES, frameStart, ts - frameStart, a);
+				frameStart = ts;
+				frame++;
+				break;
+
+			case PSXTRACE_SPUASYNC:
+				fprintf(out, "{\"name\":\"async\",\"ph\":\"i\",\"s\":\"t\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,"
+					"\"args\":{\"host_us\":%u,\"cycles\":%u}},\n", TRACK_SPU, ts, a, c);
+				break;
+		}
+	}
+
+	// Chrome wants the array closed without a trailing comma
+	fprintf(out, "{\"name\":\"end\",\"ph\":\"i\",\"s\":\"g\",\"pid\":0,\"tid\":%d,\"ts\":%.3f}\n]}\n",
+		TRACK_CPU, (double)cycles * 1000000.0 / PSXCLK);
+
+	fclose(out);
+	fclose(in);
+	return 0;
+}
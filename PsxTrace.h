@@ -0,0 +1,88 @@
+/***************************************************************************
+ *   PsxTrace.h - guest event trace with Chrome export                     *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02111-1307 USA.           *
+ ***************************************************************************/
+
+#ifndef __PSXTRACE_H__
+#define __PSXTRACE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "psxcommon.h"
+
+enum {
+	PSXTRACE_EXCEPTION = 0,		// arg: pending IRQs, a: Cause, b: EPC
+	PSXTRACE_DMA_START,			// arg: channel, a: MADR, b: BCR
+	PSXTRACE_DMA_IRQ,			// arg: channel
+	PSXTRACE_CDR_IRQ,			// arg: command, a: status
+	PSXTRACE_UPDATELACE,		// a: host usecs spent in the GPU plugin
+	PSXTRACE_SPUASYNC,			// a: host usecs spent in the SPU plugin, b: cycles
+	PSXTRACE_NUM_EVENTS
+}; // Trace event types
+
+typedef struct {
+	u32 cycle;
+	u16 type;
+	u16 arg;
+	u32 a, b;
+} PsxTraceEvent;
+
+typedef struct {
+	boolean enabled;
+	u32 head;					// events ever recorded, the ring keeps the last PSXTRACE_RING
+	PsxTraceEvent *ring;
+} PsxTraceRing;
+
+#define PSXTRACE_RING	16384	// power of 2
+
+extern PsxTraceRing psxTrace;
+
+int PsxTraceStart();
+void PsxTraceStop();
+u32 PsxTraceUsec();
+
+int PsxTraceSave(const char *filename);
+int PsxTraceConvert(const char *filename, const char *jsonname);
+
+#define PSXTRACE(type_, arg_, a_, b_) do { \
+	if (psxTrace.enabled) { \
+		PsxTraceEvent *ev = &psxTrace.ring[psxTrace.head++ & (PSXTRACE_RING - 1)]; \
+		ev->cycle = psxCore.cycle; \
+		ev->type = (type_); \
+		ev->arg = (arg_); \
+		ev->a = (a_); \
+		ev->b = (b_); \
+	} \
+} while (0)
+
+// Times a plugin call on the host while tracing
+#define PSXTRACE_CALL(type_, b_, call) do { \
+	if (psxTrace.enabled) { \
+		u32 traceStart = PsxTraceUsec(); \
+		call; \
+		PSXTRACE(type_, 0, PsxTraceUsec() - traceStart, b_); \
+	} else { \
+		call; \
+	} \
+} while (0)
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -26,10 +26,35 @@
 #include "mdec.h"
 #include "PsxGpu.h"
 #include "gte.h"
+#include "psxprof.h"
+#include "psxtrace.h"
 
 R3000Acpu *psxCpu = NULL;
 _psxCore psxCore;
 
+// Guest cycles charged per instruction, in 1/16 cycle units. Only the CPU
+// is sped up: counters, VSync and the other events still run off
+// psxCore.cycle at the stock rate, so more code retires per frame.
+u32 psxCpuCycles = BIAS << 4;
+
+void psxSetCpuClock() {
+	static const u8 cycles[] = {
+		BIAS << 4,				// CPU_CLOCK_1X
+		(BIAS << 4) * 2 / 3,	// CPU_CLOCK_1_5X
+		(BIAS << 4) / 2,		// CPU_CLOCK_2X
+		(BIAS << 4) / 3			// CPU_CLOCK_3X
+	};
+	u32 old = psxCpuCycles;
+
+	if (Config.CpuClock > CPU_CLOCK_3X)
+		Config.CpuClock = CPU_CLOCK_1X;
+	psxCpuCycles = cycles[Config.CpuClock];
+
+	// compiled blocks carry their cycle counts
+	if (psxCpu != NULL && psxCpuCycles != old)
+		psxCpu->Reset();
+}
+
 int psxInit() {
 	SysPrintf(_("Running PCSX Version %s (%s).\n"), PACKAGE_VERSION, __DATE__);
 
@@ -49,6 +74,7 @@ int psxInit() {
 }
 
 void psxReset() {
+	psxSetCpuClock();
 	psxCpu->Reset();
 
 	psxMemReset();
@@ -73,6 +99,7 @@ void psxReset() {
 }
 
 void psxShutdown() {
+	mdecShutdown();
 	psxMemShutdown();
 	psxBiosShutdown();
 
@@ -80,6 +107,8 @@ void psxShutdown() {
 }
 
 void psxException(u32 code, u32 bd) {
+	PSXTRACE(PSXTRACE_EXCEPTION, psxHu32(0x1070) & psxHu32(0x1074), code, psxCore.pc);
+
 	// Set the Cause
 	psxCore.CP0.n.Cause = code;
 
@@ -107,6 +136,8 @@ void psxException(u32 code, u32 bd) {
 }
 
 void psxBranchTest() {
+	PSXPROF_SAMPLE();
+
 	// GameShark Sampler: Give VSync pin some delay before exception eats it
 	if (psxHu32(0x1070) & psxHu32(0x1074)) {
 		if ((psxCore.CP0.n.Status & 0x401) == 0x401) {
@@ -238,6 +269,12 @@ void psxBranchTest() {
 }
 
 void psxJumpTest() {
+	if (!Config.HLE && psxProf.enabled) {
+		u32 vector = psxCore.pc & 0x1fffff;
+		if (vector == 0xa0 || vector == 0xb0 || vector == 0xc0)
+			PSXPROF_BIOS((vector >> 4) - 0xa, psxCore.GPR.n.t1);
+	}
+
 	if (!Config.HLE && Config.PsxOut) {
 		u32 call = psxCore.GPR.n.t1 & 0xff;
 		switch (psxCore.pc & 0x1fffff) {
@@ -273,3 +310,257 @@ void psxExecuteBios() {
 		psxCpu->ExecuteBlock();
 }
 
+/*
+Idle loops
+
+Games wait for VSync, a DMA or a CD-ROM interrupt by spinning on I_STAT,
+GPU status or a flag in RAM set by their interrupt handler. A backward
+branch over a short loop that only loads and computes, where every value
+it produces is rebuilt from scratch on each pass, will keep spinning
+until one of the scheduled events in psxBranchTest changes memory. Such
+loops can jump straight to that event instead of running it out.
+*/
+
+#define IDLE_CACHE		64
+#define IDLE_MAXLEN		16
+#define IDLE_MAXLOADS	4
+
+typedef struct {
+	u32 pc;						// address of the closing branch
+	u32 start;					// loop target
+	u32 code[IDLE_MAXLEN];
+	u8 len;
+	u8 idle;
+	u8 loads;
+	u8 base[IDLE_MAXLOADS];
+	s16 imm[IDLE_MAXLOADS];
+} psxIdle;
+
+static psxIdle idleCache[IDLE_CACHE];
+
+static void psxIdleRegs(u32 code, u32 *rd, u32 *rs) {
+	u32 op = code >> 26;
+
+	*rd = *rs = 0;
+	switch (op) {
+		case 0x00: // SPECIAL
+			*rd = 1 << _fRd_(code);
+			switch (code & 0x3f) {
+				case 0x00: case 0x02: case 0x03: // SLL/SRL/SRA
+					*rs = 1 << _fRt_(code);
+					break;
+				default:
+					*rs = (1 << _fRs_(code)) | (1 << _fRt_(code));
+					break;
+			}
+			break;
+		case 0x01: // REGIMM
+		case 0x06: case 0x07: // BLEZ/BGTZ
+			*rs = 1 << _fRs_(code);
+			break;
+		case 0x04: case 0x05: // BEQ/BNE
+			*rs = (1 << _fRs_(code)) | (1 << _fRt_(code));
+			break;
+		case 0x0f: // LUI
+			*rd = 1 << _fRt_(code);
+			break;
+		default: // ALU immediate and loads
+			if (op >= 0x08) {
+				*rd = 1 << _fRt_(code);
+				*rs = 1 << _fRs_(code);
+			}
+			break;
+	}
+	*rd &= ~1;
+	*rs &= ~1;
+}
+
+static int psxIdleOp(u32 code) {
+	u32 op = code >> 26;
+
+	if (op == 0x00) {
+		switch (code & 0x3f) {
+			case 0x00: case 0x02: case 0x03: case 0x04: case 0x06: case 0x07:
+			case 0x20: case 0x21: case 0x22: case 0x23: case 0x24: case 0x25:
+			case 0x26: case 0x27: case 0x2a: case 0x2b:
+				return 1;
+		}
+		return 0;
+	}
+
+	return (op >= 0x08 && op <= 0x0f) || op == 0x20 || op == 0x21 ||
+		op == 0x23 || op == 0x24 || op == 0x25;
+}
+
+static void psxIdleAnalyse(psxIdle *loop, u32 bpc) {
+	u32 code, rd, rs, written, later;
+	u32 suffix[IDLE_MAXLEN + 1];
+	u32 *p;
+	int i, n;
+
+	loop->pc = bpc;
+	loop->len = 0;
+	loop->idle = FALSE;
+	loop->loads = 0;
+
+	p = (u32 *)PSXM(bpc);
+	if (p == NULL) return;
+	code = SWAP32(*p);
+
+	switch (code >> 26) {
+		case 0x01: // BLTZ/BGEZ, not the linking ones
+			if (_fRt_(code) > 1) return;
+			// fall through
+		case 0x04: case 0x05: case 0x06: case 0x07:
+			loop->start = bpc + 4 + ((s16)_fIm_(code) << 2);
+			break;
+		case 0x02: // J
+			loop->start = (_fTarget_(code) << 2) | ((bpc + 4) & 0xf0000000);
+			break;
+		default:
+			return;
+	}
+
+	if (loop->start > bpc || bpc + 4 - loop->start >= IDLE_MAXLEN * 4)
+		return;
+
+	n = ((bpc + 4 - loop->start) >> 2) + 1;
+	for (i = 0; i < n; i++) {
+		p = (u32 *)PSXM(loop->start + i * 4);
+		if (p == NULL) return;
+		loop->code[i] = SWAP32(*p);
+	}
+	loop->len = n;
+
+	// body and delay slot may only load and compute
+	for (i = 0; i < n; i++) {
+		if (i != n - 2 && !psxIdleOp(loop->code[i]))
+			return;
+	}
+
+	// registers written after each instruction, in execution order
+	suffix[n] = 0;
+	for (i = n - 1; i >= 0; i--) {
+		psxIdleRegs(loop->code[i], &rd, &rs);
+		suffix[i] = suffix[i + 1] | rd;
+	}
+
+	// a register the loop writes must not be read before it is written,
+	// or one pass would feed the next
+	written = 0;
+	for (i = 0; i < n; i++) {
+		code = loop->code[i];
+		psxIdleRegs(code, &rd, &rs);
+		if (rs & suffix[0] & ~written)
+			return;
+		written |= rd;
+
+		if (code >> 26 >= 0x20) {
+			// the base has to hold the same value once the pass is over
+			later = suffix[i];
+			if ((later & (1 << _fRs_(code))) || loop->loads == IDLE_MAXLOADS)
+				return;
+			loop->base[loop->loads] = _fRs_(code);
+			loop->imm[loop->loads] = (s16)_fIm_(code);
+			loop->loads++;
+		}
+	}
+
+	loop->idle = TRUE;
+}
+
+static psxIdle *psxIdleLookup(u32 bpc) {
+	psxIdle *loop = &idleCache[(bpc >> 2) & (IDLE_CACHE - 1)];
+	u32 *p;
+	int i;
+
+	if (loop->pc == bpc) {
+		if (!loop->idle)
+			return loop;
+		for (i = 0; i < loop->len; i++) {
+			p = (u32 *)PSXM(loop->start + i * 4);
+			if (p == NULL || SWAP32(*p) != loop->code[i])
+				break;
+		}
+		if (i == loop->len)
+			return loop;
+	}
+
+	psxIdleAnalyse(loop, bpc);
+	return loop;
+}
+
+// Whether reading this address has no side effects and only changes
+// when a scheduled event fires. Root counters follow the cycle count,
+// and the GPU plugin fakes busy/interlace bits that flip on every read
+// of its status, so both are left out along with the SPU.
+static int psxIdleAddr(u32 addr) {
+	addr &= 0x1fffffff;
+
+	if (addr < 0x00800000) return TRUE;						// RAM
+	if (addr >= 0x1f800000 && addr < 0x1f800400) return TRUE;	// scratchpad
+
+	switch (addr & ~3) {
+		case 0x1f801070: case 0x1f801074:	// I_STAT/I_MASK
+		case 0x1f801824:					// MDEC status
+			return TRUE;
+		case 0x1f801800:					// CD-ROM status, not the FIFOs
+			return addr == 0x1f801800;
+	}
+
+	return addr >= 0x1f801080 && addr < 0x1f801100;		// DMA
+}
+
+// Cycles until psxBranchTest has something to do
+static s32 psxNextEvent() {
+	static const u32 events = (1 << PSXINT_SIO) | (1 << PSXINT_CDR) |
+		(1 << PSXINT_CDREAD) | (1 << PSXINT_GPUDMA) | (1 << PSXINT_MDECOUTDMA) |
+		(1 << PSXINT_SPUDMA) | (1 << PSXINT_GPUBUSY) | (1 << PSXINT_MDECINDMA) |
+		(1 << PSXINT_GPUOTCDMA) | (1 << PSXINT_CDRDMA) | (1 << PSXINT_CDRDBUF) |
+		(1 << PSXINT_CDRLID) | (1 << PSXINT_CDRPLAY);
+	u32 pending = psxCore.interrupt & events;
+	s32 next, left;
+	int i;
+
+	if (Config.Sio)
+		pending &= ~(1 << PSXINT_SIO);
+
+	next = psxNextCounter - (psxCore.cycle - psxNextsCounter);
+
+	for (i = 0; pending; i++, pending >>= 1) {
+		if (!(pending & 1)) continue;
+		left = psxCore.intCycle[i].cycle - (psxCore.cycle - psxCore.intCycle[i].sCycle);
+		if (left < next) next = left;
+	}
+
+	return next;
+}
+
+// Returns TRUE when the branch at bpc closes a loop psxIdleSkip may cut short
+boolean psxIdleLoop(u32 bpc) {
+	return psxIdleLookup(bpc)->idle;
+}
+
+// Called with psxCore.pc at the top of the loop, when the branch at bpc
+// was taken and the pass has completed.
+void psxIdleSkip(u32 bpc) {
+	psxIdle *loop = psxIdleLookup(bpc);
+	s32 next;
+	int i;
+
+	if (!loop->idle || psxCore.pc != loop->start)
+		return;
+
+	// an interrupt is already due
+	if (psxHu32(0x1070) & psxHu32(0x1074))
+		return;
+
+	for (i = 0; i < loop->loads; i++) {
+		if (!psxIdleAddr(psxCore.GPR.r[loop->base[i]] + loop->imm[i]))
+			return;
+	}
+
+	next = psxNextEvent();
+	if (next > 0)
+		psxCore.cycle += next;
+}
@@ -181,6 +181,7 @@ typedef struct {
 } _psxCore;
 
 extern _psxCore psxCore;
+extern u32 psxCpuCycles;
 
 /*
 Formula One 2001
@@ -336,6 +337,9 @@ int  psxTestLoadDelay(int reg, u32 tmp);
 void psxDelayTest(int reg, u32 bpc);
 void psxTestSWInts();
 void psxJumpTest();
+void psxSetCpuClock();
+boolean psxIdleLoop(u32 bpc);
+void psxIdleSkip(u32 bpc);
 
 #ifdef __cplusplus
 }
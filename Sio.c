@@ -74,10 +74,10 @@ static unsigned char adrH, adrL;
 static unsigned int padst;
 static unsigned int gsdonglest;
 
-#ifdef HW_RVL
-#include "Gamecube/MEM2.h"
-#else
+#ifdef HW_DOL
 #include "Gamecube/ARAM.h"
+#else
+#include "Gamecube/MEM2.h"
 #endif
 unsigned char *Mcd1Data = (unsigned char*)MCD1_LO;
 unsigned char *Mcd2Data = (unsigned char*)MCD2_LO;
@@ -1134,7 +1134,7 @@ void GetMcdBlockInfo(int mcd, int block, McdBlock *Info) {
 	strncpy(Info->Name, ptr, 16);
 }
 
-int sioFreeze(gzFile f, int Mode) {
+int sioFreeze(FreezeBuf *f, int Mode) {
 	gzfreeze(buf, sizeof(buf));
 	gzfreeze(&StatReg, sizeof(StatReg));
 	gzfreeze(&ModeReg, sizeof(ModeReg));
@@ -53,7 +53,7 @@ unsigned short sioReadBaud16();
 void netError();
 
 void sioInterrupt();
-int sioFreeze(gzFile f, int Mode);
+int sioFreeze(FreezeBuf *f, int Mode);
 
 extern int LoadMcd(int mcd, fileBrowser_file *savepath);
 extern int LoadMcds(fileBrowser_file *mcd1, fileBrowser_file *mcd2);
@@ -0,0 +1,505 @@
+/***************************************************************************
+ *   SpuTrace.c - SPU trace capture and offline replay                     *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02111-1307 USA.           *
+ ***************************************************************************/
+
+/*
+* SPU trace capture and offline replay.
+*
+* While capturing, the SPU plugin entry points are replaced by wrappers that
+* log every call with the guest cycle it happened at, then forward it. A
+* replay feeds the log back into whatever SPU plugin is loaded, with no CPU
+* emulation, and collects the mixed output into a WAV file.
+*
+* File layout: the 8-byte magic, then one record per call: the record type
+* byte, the cycles elapsed since the previous record (LEB128), and the call
+* arguments. All multi-byte values are little-endian. DMA payloads come
+* straight from psxM and CDDA payloads from the raw sector (or the FLAC
+* decoder, which emits the same layout); both are little-endian guest bytes
+* on every host and are stored untouched, so a trace captured on the console
+* replays on x86 and the other way round.
+*
+* Capture wraps the function pointers, so it should be started before the
+* game boots: the dynarec calls SPU_readRegister through an address baked
+* into already compiled blocks, and a replay starts from a freshly opened SPU.
+*/
+
+#include "sputrace.h"
+#include "r3000a.h"
+#include <sys/time.h>
+
+#define TRACE_MAGIC		"PSXSPUT1"
+#define TRACE_BUFSIZE	(64 * 1024)
+#define TRACE_DMAMAX	0x200000		// a DMA or CDDA payload never exceeds RAM
+
+// sample frames an xa_decode_t's pcm buffer holds
+#define TRACE_XA_MAX(stereo) \
+	((int)(sizeof(((xa_decode_t *)0)->pcm) / sizeof(short)) >> ((stereo) ? 1 : 0))
+
+void (*SpuTraceSink)(unsigned char *pSound, long lBytes) = NULL;
+
+static FILE *traceFile = NULL;
+static u8 traceBuf[TRACE_BUFSIZE];
+static u32 tracePos;
+static u32 traceCycle;
+
+static SPUwriteRegister    realWriteRegister;
+static SPUreadRegister     realReadRegister;
+static SPUwriteDMA         realWriteDMA;
+static SPUreadDMA          realReadDMA;
+static SPUwriteDMAMem      realWriteDMAMem;
+static SPUreadDMAMem       realReadDMAMem;
+static SPUplayADPCMchannel realPlayADPCMchannel;
+static SPUplayCDDAchannel  realPlayCDDAchannel;
+static SPUasync            realAsync;
+
+static const char *opNames[SPUTRACE_NUM_OPS] = {
+	"writeRegister", "readRegister", "writeDMA", "readDMA",
+	"writeDMAMem", "readDMAMem", "playADPCMchannel", "playCDDAchannel",
+	"async"
+};
+
+static u32 TraceUsec() {
+	struct timeval now;
+
+	gettimeofday(&now, NULL);
+	return now.tv_sec * 1000000 + now.tv_usec;
+}
+
+//============================================
+//===  CAPTURE
+//============================================
+
+static void TraceFlush() {
+	if (tracePos) {
+		fwrite(traceBuf, 1, tracePos, traceFile);
+		tracePos = 0;
+	}
+}
+
+static void TraceData(const void *data, u32 size) {
+	const u8 *p = (const u8 *)data;
+
+	while (size) {
+		u32 n = TRACE_BUFSIZE - tracePos;
+		if (n > size) n = size;
+		memcpy(traceBuf + tracePos, p, n);
+		tracePos += n;
+		p += n;
+		size -= n;
+		if (tracePos == TRACE_BUFSIZE)
+			TraceFlush();
+	}
+}
+
+static void Trace8(u8 v) {
+	TraceData(&v, 1);
+}
+
+static void Trace16(u16 v) {
+	u8 b[2] = { v, v >> 8 };
+	TraceData(b, 2);
+}
+
+static void Trace32(u32 v) {
+	u8 b[4] = { v, v >> 8, v >> 16, v >> 24 };
+	TraceData(b, 4);
+}
+
+static void TraceRecord(u8 op) {
+	u32 delta = psxCore.cycle - traceCycle;
+
+	traceCycle = psxCore.cycle;
+	Trace8(op);
+	while (delta >= 0x80) {
+		Trace8((delta & 0x7f) | 0x80);
+		delta >>= 7;
+	}
+	Trace8(delta);
+}
+
+static void CALLBACK traceWriteRegister(unsigned long reg, unsigned short val) {
+	TraceRecord(SPUTRACE_WRITEREG);
+	Trace32(reg);
+	Trace16(val);
+	realWriteRegister(reg, val);
+}
+
+static unsigned short CALLBACK traceReadRegister(unsigned long reg) {
+	TraceRecord(SPUTRACE_READREG);
+	Trace32(reg);
+	return realReadRegister(reg);
+}
+
+static void CALLBACK traceWriteDMA(unsigned short val) {
+	TraceRecord(SPUTRACE_WRITEDMA);
+	Trace16(val);
+	realWriteDMA(val);
+}
+
+static unsigned short CALLBACK traceReadDMA(void) {
+	TraceRecord(SPUTRACE_READDMA);
+	return realReadDMA();
+}
+
+static void CALLBACK traceWriteDMAMem(unsigned short *pusPSXMem, int iSize) {
+	TraceRecord(SPUTRACE_WRITEDMAMEM);
+	Trace32(iSize);
+	TraceData(pusPSXMem, iSize * 2);	// guest memory, already little-endian
+	realWriteDMAMem(pusPSXMem, iSize);
+}
+
+static void CALLBACK traceReadDMAMem(unsigned short *pusPSXMem, int iSize) {
+	TraceRecord(SPUTRACE_READDMAMEM);
+	Trace32(iSize);
+	realReadDMAMem(pusPSXMem, iSize);
+}
+
+static void CALLBACK tracePlayADPCMchannel(xa_decode_t *xap) {
+	int i, count, nsamples;
+
+	nsamples = xap->nsamples;
+	if (nsamples > TRACE_XA_MAX(xap->stereo))
+		nsamples = TRACE_XA_MAX(xap->stereo);
+	count = xap->stereo ? nsamples * 2 : nsamples;
+
+	TraceRecord(SPUTRACE_PLAYADPCM);
+	Trace32(xap->freq);
+	Trace8(xap->nbits);
+	Trace8(xap->stereo);
+	Trace32(nsamples);
+	for (i = 0; i < count; i++)
+		Trace16(xap->pcm[i]);
+	realPlayADPCMchannel(xap);
+}
+
+static void CALLBACK tracePlayCDDAchannel(short *pcm, int nbytes) {
+	TraceRecord(SPUTRACE_PLAYCDDA);
+	Trace32(nbytes);
+	TraceData(pcm, nbytes);				// raw sector bytes, already little-endian
+	realPlayCDDAchannel(pcm, nbytes);
+}
+
+static void CALLBACK traceAsync(uint32_t cycle) {
+	TraceRecord(SPUTRACE_ASYNC);
+	Trace32(cycle);
+	realAsync(cycle);
+}
+
+int SpuTraceStart(const char *filename) {
+	if (traceFile != NULL)
+		SpuTraceStop();
+
+	traceFile = fopen(filename, "wb");
+	if (traceFile == NULL) {
+		SysPrintf(_("Could not open SPU trace %s.\n"), filename);
+		return -1;
+	}
+	fwrite(TRACE_MAGIC, 1, 8, traceFile);
+	tracePos = 0;
+	traceCycle = psxCore.cycle;
+
+	realWriteRegister = SPU_writeRegister;
+	realReadRegister = SPU_readRegister;
+	realWriteDMA = SPU_writeDMA;
+	realReadDMA = SPU_readDMA;
+	realWriteDMAMem = SPU_writeDMAMem;
+	realReadDMAMem = SPU_readDMAMem;
+	realPlayADPCMchannel = SPU_playADPCMchannel;
+	realPlayCDDAchannel = SPU_playCDDAchannel;
+	realAsync = SPU_async;
+
+	SPU_writeRegister = traceWriteRegister;
+	SPU_readRegister = traceReadRegister;
+	SPU_writeDMA = traceWriteDMA;
+	SPU_readDMA = traceReadDMA;
+	SPU_writeDMAMem = traceWriteDMAMem;
+	SPU_readDMAMem = traceReadDMAMem;
+	SPU_playADPCMchannel = tracePlayADPCMchannel;
+	// optional entry points stay NULL so callers keep skipping them
+	if (realPlayCDDAchannel != NULL) SPU_playCDDAchannel = tracePlayCDDAchannel;
+	if (realAsync != NULL) SPU_async = traceAsync;
+
+	return 0;
+}
+
+void SpuTraceStop() {
+	if (traceFile == NULL)
+		return;
+
+	SPU_writeRegister = realWriteRegister;
+	SPU_readRegister = realReadRegister;
+	SPU_writeDMA = realWriteDMA;
+	SPU_readDMA = realReadDMA;
+	SPU_writeDMAMem = realWriteDMAMem;
+	SPU_readDMAMem = realReadDMAMem;
+	SPU_playADPCMchannel = realPlayADPCMchannel;
+	SPU_playCDDAchannel = realPlayCDDAchannel;
+	SPU_async = realAsync;
+
+	TraceFlush();
+	fclose(traceFile);
+	traceFile = NULL;
+}
+
+boolean SpuTraceActive() {
+	return traceFile != NULL;
+}
+
+//============================================
+//===  REPLAY
+//============================================
+
+static FILE *wavFile = NULL;
+static u32 wavBytes;
+static int replayShort;				// set once a read runs past the end of the trace
+
+static void WavPut16(FILE *f, u16 v) {
+	fputc(v & 0xff, f);
+	fputc(v >> 8, f);
+}
+
+static void WavPut32(FILE *f, u32 v) {
+	WavPut16(f, v & 0xffff);
+	WavPut16(f, v >> 16);
+}
+
+static void WavHeader(FILE *f, int channels, u32 bytes) {
+	fwrite("RIFF", 1, 4, f);
+	WavPut32(f, 36 + bytes);
+	fwrite("WAVEfmt ", 1, 8, f);
+	WavPut32(f, 16);
+	WavPut16(f, 1);							// PCM
+	WavPut16(f, channels);
+	WavPut32(f, 44100);
+	WavPut32(f, 44100 * channels * 2);
+	WavPut16(f, channels * 2);
+	WavPut16(f, 16);
+	fwrite("data", 1, 4, f);
+	WavPut32(f, bytes);
+}
+
+static void ReplaySink(unsigned char *pSound, long lBytes) {
+	wavBytes += lBytes;
+	if (wavFile != NULL) {
+		short *s = (short *)pSound;
+		long i;
+
+		// the mixer produces host-endian samples, WAV wants little-endian
+		for (i = 0; i < lBytes / 2; i++)
+			WavPut16(wavFile, s[i]);
+	}
+}
+
+static int Get8(FILE *f, u8 *v) {
+	int c = getc(f);
+	if (c == EOF) return -1;
+	*v = c;
+	return 0;
+}
+
+static u16 Get16(FILE *f) {
+	u8 b[2] = { 0, 0 };
+	if (fread(b, 1, 2, f) != 2) replayShort = 1;
+	return b[0] | (b[1] << 8);
+}
+
+static u32 Get32(FILE *f) {
+	u8 b[4] = { 0, 0, 0, 0 };
+	if (fread(b, 1, 4, f) != 4) replayShort = 1;
+	return b[0] | (b[1] << 8) | (b[2] << 16) | ((u32)b[3] << 24);
+}
+
+static u32 GetVar(FILE *f) {
+	u32 v = 0;
+	int shift = 0;
+	u8 b;
+
+	do {
+		if (Get8(f, &b)) { replayShort = 1; break; }
+		v |= (u32)(b & 0x7f) << shift;
+		shift += 7;
+	} while (b & 0x80);
+
+	return v;
+}
+
+// Replays a capture through the currently opened SPU plugin. The caller
+// loads and opens the plugins; psxMemInit() must have run for the SPU IRQ.
+// A truncated or corrupt trace stops the replay and returns -1, with the
+// stats and WAV covering the records played up to that point.
+int SpuTraceReplay(const char *filename, const char *wavname, int stereo, SpuTraceStats *stats) {
+	static xa_decode_t xa;
+	unsigned short *dma = NULL;
+	u32 dmaSize = 0;
+	char magic[8];
+	FILE *f;
+	u32 start, t = 0;
+	u8 op, c;
+	int ret = 0;
+
+	memset(stats, 0, sizeof(SpuTraceStats));
+
+	f = fopen(filename, "rb");
+	if (f == NULL) {
+		SysPrintf(_("Could not open SPU trace %s.\n"), filename);
+		return -1;
+	}
+	if (fread(magic, 1, 8, f) != 8 || memcmp(magic, TRACE_MAGIC, 8)) {
+		SysPrintf(_("%s is not an SPU trace.\n"), filename);
+		fclose(f);
+		return -1;
+	}
+
+	wavBytes = 0;
+	if (wavname != NULL) {
+		wavFile = fopen(wavname, "wb");
+		if (wavFile != NULL) WavHeader(wavFile, stereo ? 2 : 1, 0);
+	}
+	SpuTraceSink = ReplaySink;
+	replayShort = 0;
+
+	start = TraceUsec();
+	while (!Get8(f, &op) && op < SPUTRACE_NUM_OPS) {
+		u32 a, b, i;
+
+		GetVar(f);	// cycle delta, the plugin only sees what SPU_async is told
+
+		// read the arguments first so only the plugin call is timed
+		switch (op) {
+			case SPUTRACE_WRITEREG:
+				a = Get32(f); b = Get16(f);
+				if (replayShort) break;
+				t = TraceUsec();
+				SPU_writeRegister(a, b);
+				break;
+			case SPUTRACE_READREG:
+				a = Get32(f);
+				if (replayShort) break;
+				t = TraceUsec();
+				SPU_readRegister(a);
+				break;
+			case SPUTRACE_WRITEDMA:
+				a = Get16(f);
+				if (replayShort) break;
+				t = TraceUsec();
+				SPU_writeDMA(a);
+				break;
+			case SPUTRACE_READDMA:
+				t = TraceUsec();
+				SPU_readDMA();
+				break;
+			case SPUTRACE_WRITEDMAMEM:
+			case SPUTRACE_READDMAMEM:
+			case SPUTRACE_PLAYCDDA:
+				a = Get32(f);
+				if (replayShort) break;
+				if (a > TRACE_DMAMAX) {
+					SysPrintf(_("SPU trace %s: bad transfer size %u.\n"), filename, a);
+					ret = -1;
+					break;
+				}
+				b = (op == SPUTRACE_PLAYCDDA) ? a : a * 2;
+				if (b > dmaSize) {
+					free(dma);
+					dmaSize = b;
+					dma = (unsigned short *)malloc(dmaSize);
+					if (dma == NULL) {
+						SysPrintf(_("SPU trace %s: out of memory.\n"), filename);
+						dmaSize = 0;
+						ret = -1;
+						break;
+					}
+				}
+				if (op != SPUTRACE_READDMAMEM && fread(dma, 1, b, f) != b) {
+					replayShort = 1;
+					break;
+				}
+				t = TraceUsec();
+				if (op == SPUTRACE_WRITEDMAMEM) SPU_writeDMAMem(dma, a);
+				else if (op == SPUTRACE_READDMAMEM) SPU_readDMAMem(dma, a);
+				else if (SPU_playCDDAchannel != NULL) SPU_playCDDAchannel((short *)dma, a);
+				break;
+			case SPUTRACE_PLAYADPCM:
+				xa.freq = Get32(f);
+				if (Get8(f, &c)) { replayShort = 1; break; }
+				xa.nbits = c;
+				if (Get8(f, &c)) { replayShort = 1; break; }
+				xa.stereo = c;
+				a = Get32(f);
+				if (replayShort) break;
+				if (a > (u32)TRACE_XA_MAX(xa.stereo)) {
+					SysPrintf(_("SPU trace %s: bad XA sample count %u.\n"), filename, a);
+					ret = -1;
+					break;
+				}
+				xa.nsamples = a;
+				if (xa.stereo) a *= 2;
+				for (i = 0; i < a; i++)
+					xa.pcm[i] = Get16(f);
+				if (replayShort) break;
+				t = TraceUsec();
+				SPU_playADPCMchannel(&xa);
+				break;
+			case SPUTRACE_ASYNC:
+				a = Get32(f);
+				if (replayShort) break;
+				t = TraceUsec();
+				if (SPU_async != NULL) SPU_async(a);
+				break;
+		}
+		if (replayShort) {
+			SysPrintf(_("SPU trace %s is truncated.\n"), filename);
+			ret = -1;
+		}
+		if (ret < 0) break;
+
+		stats->usecs[op] += TraceUsec() - t;
+		stats->count[op]++;
+		stats->records++;
+	}
+	stats->usec = TraceUsec() - start;
+	stats->frames = wavBytes / (stereo ? 4 : 2);
+
+	SpuTraceSink = NULL;
+	free(dma);
+	fclose(f);
+
+	if (wavFile != NULL) {
+		fseek(wavFile, 0, SEEK_SET);
+		WavHeader(wavFile, stereo ? 2 : 1, wavBytes);
+		fclose(wavFile);
+		wavFile = NULL;
+	}
+
+	return ret;
+}
+
+void SpuTracePrintStats(const SpuTraceStats *stats) {
+	int i;
+
+	SysPrintf("SPU replay: %u records, %u frames in %u.%03u s",
+		stats->records, stats->frames, stats->usec / 1000000, (stats->usec / 1000) % 1000);
+	if (stats->usec)
+		SysPrintf(" (%.0f samples/sec)", stats->frames * 1000000.0 / stats->usec);
+	SysPrintf("\n");
+
+	for (i = 0; i < SPUTRACE_NUM_OPS; i++) {
+		if (!stats->count[i]) continue;
+		SysPrintf("  %-18s %9u calls %9u us\n", opNames[i], stats->count[i], stats->usecs[i]);
+	}
+}
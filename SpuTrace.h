@@ -0,0 +1,65 @@
+/***************************************************************************
+ *   SpuTrace.h - SPU trace capture and offline replay                     *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02111-1307 USA.           *
+ ***************************************************************************/
+
+#ifndef __SPUTRACE_H__
+#define __SPUTRACE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "psxcommon.h"
+#include "plugins.h"
+
+enum {
+	SPUTRACE_WRITEREG = 0,
+	SPUTRACE_READREG,
+	SPUTRACE_WRITEDMA,
+	SPUTRACE_READDMA,
+	SPUTRACE_WRITEDMAMEM,
+	SPUTRACE_READDMAMEM,
+	SPUTRACE_PLAYADPCM,
+	SPUTRACE_PLAYCDDA,
+	SPUTRACE_ASYNC,
+	SPUTRACE_NUM_OPS
+}; // Trace record types
+
+typedef struct {
+	u32 records;
+	u32 frames;					// sample frames rendered by the SPU
+	u32 usec;					// total replay time
+	u32 count[SPUTRACE_NUM_OPS];
+	u32 usecs[SPUTRACE_NUM_OPS];
+} SpuTraceStats;
+
+// Set while a trace is replayed: output backends hand every mixed block
+// here instead of to the audio hardware.
+extern void (*SpuTraceSink)(unsigned char *pSound, long lBytes);
+
+int SpuTraceStart(const char *filename);
+void SpuTraceStop();
+boolean SpuTraceActive();
+
+int SpuTraceReplay(const char *filename, const char *wavname, int stereo, SpuTraceStats *stats);
+void SpuTracePrintStats(const SpuTraceStats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
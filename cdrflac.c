@@ -0,0 +1,525 @@
+/***************************************************************************
+ *   cdrflac.c - FLAC decoder for separate-file audio tracks               *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02111-1307 USA.           *
+ ***************************************************************************/
+
+/*
+* FLAC decoder for the audio tracks of a disc image.
+*
+* Only what a ripped CD track needs: 44.1 kHz, 16 bits, one or two channels.
+* Frames are decoded one at a time and handed out as little-endian stereo,
+* the layout of a raw CD-DA sector.
+*
+* Seeks go through a frame index: the file's SEEKTABLE, if it has one, plus
+* a point about every second of audio recorded as frames go by. From the
+* nearest point the frames before the target are skipped by their headers,
+* only the one holding the target sample is decoded.
+*/
+
+#include "cdrflac.h"
+
+#define FLAC_BUFSIZE		8192
+#define FLAC_INDEX_STEP		44100	// samples between the points recorded while decoding
+
+typedef struct {
+	u32 sample;
+	u32 offset;
+} FlacPoint;
+
+typedef struct {
+	u32 sample;
+	u32 block;
+	int chan;				// channel assignment
+} FlacHeader;
+
+struct FlacFile {
+	FILE *f;
+	u8 buf[FLAC_BUFSIZE];
+	int len, pos;
+	u32 base;				// file offset of buf[0]
+	boolean eof;
+	u64 acc;				// bits read ahead
+	int nbits;
+
+	u32 samples;			// per channel
+	u32 maxBlock;
+	int channels;
+
+	FlacPoint *index;
+	int indexCount, indexSize;
+
+	s32 *pcm[2];			// the frame being handed out
+	u32 frameSample, frameLen, framePos;
+	u32 nextSample;
+};
+
+//============================================
+//===  BIT READER
+//============================================
+
+static int FlacByte(FlacFile *f) {
+	if (f->pos == f->len) {
+		f->base += f->len;
+		f->pos = 0;
+		f->len = fread(f->buf, 1, FLAC_BUFSIZE, f->f);
+		if (f->len <= 0) {
+			f->len = 0;
+			f->eof = TRUE;
+			return 0;
+		}
+	}
+	return f->buf[f->pos++];
+}
+
+// Only meaningful on a byte boundary
+static u32 FlacTell(FlacFile *f) {
+	return f->base + f->pos;
+}
+
+static void FlacSeekByte(FlacFile *f, u32 offset) {
+	f->nbits = 0;
+	f->eof = FALSE;
+	if (offset >= f->base && offset < f->base + f->len) {
+		f->pos = offset - f->base;
+		return;
+	}
+	fseek(f->f, offset, SEEK_SET);
+	f->base = offset;
+	f->len = f->pos = 0;
+}
+
+static u32 GetBits(FlacFile *f, int n) {
+	u32 v;
+
+	while (f->nbits < n) {
+		f->acc = (f->acc << 8) | FlacByte(f);
+		f->nbits += 8;
+	}
+	f->nbits -= n;
+	v = (u32)(f->acc >> f->nbits);
+	if (n < 32) v &= (1u << n) - 1;
+	return v;
+}
+
+static s32 GetSBits(FlacFile *f, int n) {
+	if (n == 0) return 0;
+	return (s32)(GetBits(f, n) << (32 - n)) >> (32 - n);
+}
+
+//============================================
+//===  FRAMES
+//============================================
+
+static u8 Crc8(const u8 *p, int n) {
+	u8 crc = 0;
+	int i;
+
+	while (n--) {
+		crc ^= *p++;
+		for (i = 0; i < 8; i++)
+			crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+	}
+	return crc;
+}
+
+// Reads a frame header, the reader must be on a byte boundary
+static int ReadHeader(FlacFile *f, FlacHeader *h) {
+	u8 b[16];
+	int n = 0, ones, i, bs, sr;
+	u32 num;
+
+	b[n++] = FlacByte(f);
+	b[n++] = FlacByte(f);
+	if (b[0] != 0xff || (b[1] & 0xfe) != 0xf8) return -1;
+	b[n++] = FlacByte(f);
+	b[n++] = FlacByte(f);
+	bs = b[2] >> 4;
+	sr = b[2] & 15;
+	h->chan = b[3] >> 4;
+	if (bs == 0 || sr == 15 || h->chan > 10 || (b[3] & 1)) return -1;
+	// only 16 bit samples, given here or by STREAMINFO
+	if (((b[3] >> 1) & 7) != 0 && ((b[3] >> 1) & 7) != 4) return -1;
+
+	// frame or sample number, coded like UTF-8
+	b[n] = FlacByte(f);
+	for (ones = 0; ones < 8 && (b[n] & (0x80 >> ones)); ones++) ;
+	if (ones == 1 || ones == 8) return -1;
+	num = b[n++] & (0x7f >> ones);
+	for (i = 1; i < ones; i++) {
+		b[n] = FlacByte(f);
+		if ((b[n] & 0xc0) != 0x80) return -1;
+		num = (num << 6) | (b[n++] & 0x3f);
+	}
+
+	if (bs == 1) h->block = 192;
+	else if (bs <= 5) h->block = 576 << (bs - 2);
+	else if (bs == 6) {
+		b[n] = FlacByte(f);
+		h->block = b[n++] + 1;
+	}
+	else if (bs == 7) {
+		b[n] = FlacByte(f);
+		b[n + 1] = FlacByte(f);
+		h->block = ((b[n] << 8) | b[n + 1]) + 1;
+		n += 2;
+	}
+	else h->block = 256 << (bs - 8);
+
+	if (sr == 12) b[n++] = FlacByte(f);
+	else if (sr == 13 || sr == 14) {
+		b[n++] = FlacByte(f);
+		b[n++] = FlacByte(f);
+	}
+
+	if (FlacByte(f) != Crc8(b, n) || f->eof) return -1;
+	if (h->block > f->maxBlock) return -1;
+
+	// a fixed blocksize stream numbers its frames instead of its samples
+	h->sample = (b[1] & 1) ? num : num * f->maxBlock;
+	return 0;
+}
+
+static int ReadResidual(FlacFile *f, s32 *s, u32 block, int order) {
+	int method = GetBits(f, 2), porder, bits, p;
+	u32 i, n;
+
+	if (method > 1) return -1;
+	bits = method ? 5 : 4;
+	porder = GetBits(f, 4);
+	if ((block >> porder) < (u32)order || (block & ((1 << porder) - 1))) return -1;
+
+	s += order;
+	for (p = 0; p < (1 << porder); p++) {
+		int k = GetBits(f, bits);
+
+		n = (block >> porder) - (p == 0 ? order : 0);
+		if (k == (1 << bits) - 1) {
+			// escaped, the residual is stored raw
+			k = GetBits(f, 5);
+			for (i = 0; i < n; i++) *s++ = GetSBits(f, k);
+			continue;
+		}
+		for (i = 0; i < n; i++) {
+			u32 q = 0, u;
+
+			while (!GetBits(f, 1)) {
+				if (f->eof) return -1;
+				q++;
+			}
+			u = (q << k) | GetBits(f, k);
+			*s++ = (s32)(u >> 1) ^ -(s32)(u & 1);
+		}
+	}
+	return 0;
+}
+
+static int ReadSubframe(FlacFile *f, s32 *s, u32 block, int bps) {
+	int type, wasted = 0, order, i, j;
+	u32 n;
+
+	if (GetBits(f, 1)) return -1;
+	type = GetBits(f, 6);
+	if (GetBits(f, 1)) {
+		wasted = 1;
+		while (!GetBits(f, 1)) {
+			if (f->eof) return -1;
+			wasted++;
+		}
+		bps -= wasted;
+		if (bps <= 0) return -1;
+	}
+
+	if (type == 0) {
+		s32 v = GetSBits(f, bps);
+		for (n = 0; n < block; n++) s[n] = v;
+	}
+	else if (type == 1) {
+		for (n = 0; n < block; n++) s[n] = GetSBits(f, bps);
+	}
+	else if (type >= 8 && type <= 12) {
+		order = type - 8;
+		for (i = 0; i < order; i++) s[i] = GetSBits(f, bps);
+		if (ReadResidual(f, s, block, order)) return -1;
+
+		for (n = order; n < block; n++) {
+			switch (order) {
+				case 1: s[n] += s[n - 1]; break;
+				case 2: s[n] += 2 * s[n - 1] - s[n - 2]; break;
+				case 3: s[n] += 3 * (s[n - 1] - s[n - 2]) + s[n - 3]; break;
+				case 4: s[n] += 4 * (s[n - 1] + s[n - 3]) - 6 * s[n - 2] - s[n - 4]; break;
+			}
+		}
+	}
+	else if (type >= 32) {
+		s32 coef[32];
+		int prec, shift;
+
+		order = type - 31;
+		for (i = 0; i < order; i++) s[i] = GetSBits(f, bps);
+		prec = GetBits(f, 4) + 1;
+		shift = GetSBits(f, 5);
+		if (prec == 16 || shift < 0) return -1;
+		for (i = 0; i < order; i++) coef[i] = GetSBits(f, prec);
+		if (ReadResidual(f, s, block, order)) return -1;
+
+		for (n = order; n < block; n++) {
+			s64 sum = 0;
+
+			for (j = 0; j < order; j++) sum += (s64)coef[j] * s[n - 1 - j];
+			s[n] += (s32)(sum >> shift);
+		}
+	}
+	else return -1;
+
+	if (wasted)
+		for (n = 0; n < block; n++) s[n] <<= wasted;
+	return 0;
+}
+
+static void AddPoint(FlacFile *f, u32 sample, u32 offset, u32 step) {
+	if (f->indexCount && sample < f->index[f->indexCount - 1].sample + step) return;
+
+	if (f->indexCount == f->indexSize) {
+		FlacPoint *grown = (FlacPoint *)realloc(f->index, (f->indexSize + 64) * sizeof(FlacPoint));
+		if (grown == NULL) return;
+		f->index = grown;
+		f->indexSize += 64;
+	}
+	f->index[f->indexCount].sample = sample;
+	f->index[f->indexCount].offset = offset;
+	f->indexCount++;
+}
+
+static int DecodeFrame(FlacFile *f) {
+	FlacHeader h;
+	u32 offset = FlacTell(f), n;
+	s32 *l = f->pcm[0], *r = f->pcm[1];
+	int ch, channels;
+
+	if (ReadHeader(f, &h)) return -1;
+	AddPoint(f, h.sample, offset, FLAC_INDEX_STEP);
+
+	channels = h.chan < 8 ? h.chan + 1 : 2;
+	if (channels != f->channels) return -1;
+	for (ch = 0; ch < channels; ch++) {
+		// the side channel takes one more bit
+		boolean side = (h.chan == 8 || h.chan == 10) ? ch == 1 : h.chan == 9 && ch == 0;
+
+		if (ReadSubframe(f, f->pcm[ch], h.block, 16 + side)) return -1;
+	}
+	// padding to the byte, then the CRC-16 (not checked)
+	f->nbits -= f->nbits & 7;
+	GetBits(f, 16);
+	if (f->eof) return -1;
+
+	switch (h.chan) {
+		case 8:		// left, side
+			for (n = 0; n < h.block; n++) r[n] = l[n] - r[n];
+			break;
+		case 9:		// side, right
+			for (n = 0; n < h.block; n++) l[n] += r[n];
+			break;
+		case 10:	// mid, side
+			for (n = 0; n < h.block; n++) {
+				s32 mid = (l[n] << 1) | (r[n] & 1), side = r[n];
+				l[n] = (mid + side) >> 1;
+				r[n] = (mid - side) >> 1;
+			}
+			break;
+	}
+
+	f->frameSample = h.sample;
+	f->frameLen = h.block;
+	f->framePos = 0;
+	f->nextSample = h.sample + h.block;
+	return 0;
+}
+
+// Moves to the header of the frame starting at the sample, searching from
+// the reader's position
+static int FindFrame(FlacFile *f, u32 sample) {
+	FlacHeader h;
+
+	for (;;) {
+		u32 offset;
+
+		if (FlacByte(f) != 0xff) {
+			if (f->eof) return -1;
+			continue;
+		}
+		offset = FlacTell(f) - 1;
+		FlacSeekByte(f, offset);
+		if (ReadHeader(f, &h) == 0 && h.sample == sample) {
+			FlacSeekByte(f, offset);
+			return 0;
+		}
+		FlacSeekByte(f, offset + 1);
+	}
+}
+
+//============================================
+//===  STREAM
+//============================================
+
+FlacFile *FlacOpen(const char *path) {
+	FlacFile *f = (FlacFile *)calloc(1, sizeof(FlacFile));
+	u8 b[10];
+	u32 rate = 0, bps = 0, first, i;
+	boolean last = FALSE;
+
+	if (f == NULL) return NULL;
+	f->f = fopen(path, "rb");
+	if (f->f == NULL) {
+		free(f);
+		return NULL;
+	}
+
+	// room for the first frame's point, filled in once it's known
+	AddPoint(f, 0, 0, 1);
+
+	// skip an ID3v2 tag
+	for (i = 0; i < 4; i++) b[i] = FlacByte(f);
+	if (!memcmp(b, "ID3", 3)) {
+		for (i = 4; i < 10; i++) b[i] = FlacByte(f);
+		FlacSeekByte(f, 10 + ((b[6] & 0x7f) << 21 | (b[7] & 0x7f) << 14 | (b[8] & 0x7f) << 7 | (b[9] & 0x7f)));
+		for (i = 0; i < 4; i++) b[i] = FlacByte(f);
+	}
+	if (memcmp(b, "fLaC", 4)) goto fail;
+
+	while (!last) {
+		u32 type, len, end;
+
+		last = GetBits(f, 1);
+		type = GetBits(f, 7);
+		len = GetBits(f, 24);
+		end = FlacTell(f) + len;
+		if (f->eof) goto fail;
+
+		if (type == 0) {			// STREAMINFO
+			GetBits(f, 16);
+			f->maxBlock = GetBits(f, 16);
+			GetBits(f, 24);
+			GetBits(f, 24);
+			rate = GetBits(f, 20);
+			f->channels = GetBits(f, 3) + 1;
+			bps = GetBits(f, 5) + 1;
+			if (GetBits(f, 4)) goto fail;	// way past what a CD holds
+			f->samples = GetBits(f, 32);
+		}
+		else if (type == 3) {		// SEEKTABLE, offsets from the first frame for now
+			for (i = 0; i < len / 18; i++) {
+				u32 shi = GetBits(f, 32), sample = GetBits(f, 32);
+				u32 ohi = GetBits(f, 32), offset = GetBits(f, 32);
+
+				GetBits(f, 16);
+				if (shi == 0 && ohi == 0) AddPoint(f, sample, offset, 1);
+			}
+		}
+		FlacSeekByte(f, end);
+	}
+	first = FlacTell(f);
+
+	if (rate != 44100 || bps != 16 || f->channels > 2 || f->maxBlock == 0) {
+		SysPrintf("FLAC: %s is not CD audio\n", path);
+		goto fail;
+	}
+
+	for (i = 0; i < (u32)f->indexCount; i++) f->index[i].offset += first;
+	f->pcm[0] = (s32 *)malloc(f->maxBlock * sizeof(s32));
+	f->pcm[1] = (s32 *)malloc(f->maxBlock * sizeof(s32));
+	if (f->pcm[0] == NULL || f->pcm[1] == NULL) goto fail;
+	return f;
+
+fail:
+	FlacClose(f);
+	return NULL;
+}
+
+void FlacClose(FlacFile *f) {
+	if (f == NULL) return;
+	fclose(f->f);
+	free(f->index);
+	free(f->pcm[0]);
+	free(f->pcm[1]);
+	free(f);
+}
+
+// Per channel
+u32 FlacSamples(FlacFile *f) {
+	return f->samples;
+}
+
+int FlacSeek(FlacFile *f, u32 sample) {
+	FlacHeader h;
+	int lo = 0, hi = f->indexCount - 1;
+	u32 next, offset;
+
+	if (sample >= f->samples) return -1;
+
+	// the last point at or before the sample
+	while (lo < hi) {
+		int mid = (lo + hi + 1) / 2;
+
+		if (f->index[mid].sample <= sample) lo = mid;
+		else hi = mid - 1;
+	}
+	FlacSeekByte(f, f->index[lo].offset);
+	next = f->index[lo].sample;
+	f->frameLen = f->framePos = 0;
+
+	for (;;) {
+		offset = FlacTell(f);
+		if (ReadHeader(f, &h) || h.sample != next) return -1;
+		AddPoint(f, h.sample, offset, FLAC_INDEX_STEP);
+		if (sample < h.sample + h.block) break;
+		next = h.sample + h.block;
+		if (FindFrame(f, next)) return -1;
+	}
+
+	FlacSeekByte(f, offset);
+	if (DecodeFrame(f)) return -1;
+	f->framePos = sample - f->frameSample;
+	return 0;
+}
+
+// Reads up to count samples as little-endian 16 bit stereo pairs, fewer
+// at the end of the stream
+int FlacRead(FlacFile *f, u8 *out, int count) {
+	int done = 0;
+
+	while (done < count) {
+		s32 *l = f->pcm[0], *r = f->pcm[f->channels - 1];
+		u32 n;
+
+		if (f->framePos == f->frameLen) {
+			if (f->nextSample >= f->samples || DecodeFrame(f)) break;
+		}
+
+		n = f->frameLen - f->framePos;
+		if (n > (u32)(count - done)) n = count - done;
+		done += n;
+		while (n--) {
+			out[0] = l[f->framePos];
+			out[1] = l[f->framePos] >> 8;
+			out[2] = r[f->framePos];
+			out[3] = r[f->framePos] >> 8;
+			out += 4;
+			f->framePos++;
+		}
+	}
+	return done;
+}
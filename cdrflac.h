@@ -0,0 +1,40 @@
+/***************************************************************************
+ *   cdrflac.h - FLAC decoder for separate-file audio tracks               *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02111-1307 USA.           *
+ ***************************************************************************/
+
+#ifndef __CDRFLAC_H__
+#define __CDRFLAC_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "psxcommon.h"
+
+typedef struct FlacFile FlacFile;
+
+FlacFile *FlacOpen(const char *path);
+void FlacClose(FlacFile *f);
+u32 FlacSamples(FlacFile *f);
+int FlacSeek(FlacFile *f, u32 sample);
+int FlacRead(FlacFile *f, u8 *out, int count);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -18,19 +18,28 @@
  *   51 Franklin Street, Fifth Floor, Boston, MA 02111-1307 USA.           *
  ***************************************************************************/
 
-#include "./GameCube/DEBUG.h"
-#include "./GameCube/MEM2.h"
+#include "./Gamecube/DEBUG.h"
+#include "./Gamecube/MEM2.h"
 #include "psxcommon.h"
 #include "plugins.h"
 #include "cdrom.h"
 #include "cdriso.h"
+#include "ppf.h"
+#include "cdrflac.h"
 
 #ifdef _WIN32
 #include <process.h>
 #include <windows.h>
 #else
 #include <ogc/lwp.h>
+#include <ogc/mutex.h>
+#include <ogc/cond.h>
 #include <sys/time.h>
+#ifdef __LINUX__
+#include <sys/mman.h>
+#include <unistd.h>
+#define CDRISO_MMAP
+#endif
 #define PLAY_STACK_SIZE 1024 // MEM: I could get away with a smaller stack
 static char  play_stack[PLAY_STACK_SIZE];
 #define PLAY_PRIORITY 100
@@ -45,8 +54,10 @@ static boolean subChanRaw = FALSE;
 
 static unsigned char* readaheadBuffer = (char*)CDREADAHEAD_LO;
 
-static unsigned char cdbuffer[DATA_SIZE];
+// Raw sectors are read whole, header included
+static unsigned char cdbuffer[CD_FRAMESIZE_RAW];
 static unsigned char subbuffer[SUB_FRAMESIZE];
+static int subSector = -1;	// sector whose .sub data is still to be read into subbuffer
 
 static unsigned char sndbuffer[CD_FRAMESIZE_RAW * 10];
 
@@ -57,6 +68,17 @@ static unsigned char sndbuffer[CD_FRAMESIZE_RAW * 10];
 
 static boolean isMode1ISO = FALSE;
 
+#ifdef CDRISO_MMAP
+// Raw 2352 byte images are mapped whole and sectors are handed out in place.
+// The mapping is private, so PPF patches applied to a sector only ever land
+// in a copy-on-write page and never reach the file.
+static unsigned char *cdMap = NULL;
+static size_t cdMapSize = 0;
+static unsigned char *cdMapSector = NULL;	// last sector read, NULL if it's in cdbuffer
+static unsigned int prefetchEnd = 0;		// first sector past the advised window
+static unsigned int prefetchLen = 0;
+#endif
+
 
 #ifdef _WIN32
 static HANDLE threadid;
@@ -77,10 +99,17 @@ long CALLBACK CDR__getStatus(struct CdrStat *stat);
 
 extern void *hCDRDriver;
 
+enum { TRACK_RAW = 0, TRACK_FLAC };
+
 struct trackinfo {
 	enum {DATA=1, CDDA} type;
 	u8 start[3];		// MSF-format
 	u8 length[3];		// MSF-format
+	char *file;			// audio in a file of its own, NULL if it's in the image
+	int format;
+	unsigned int offset;	// raw: byte offset of the audio in the file
+	unsigned int fileStart;	// first sector of the file on the disc
+	unsigned int fileLen;	// in sectors
 };
 
 #define MAXTRACKS 100 /* How many tracks can a CD hold? */
@@ -146,6 +175,283 @@ static long GetTickCount(void) {
 #endif
 
 
+/* Audio tracks stored in files of their own are decoded ahead on a worker
+ * thread into a ring of sectors, which ISOreadCDDA and the play thread take
+ * them from. A sector the worker hasn't got sends the worker there. For
+ * ISOreadCDDA it reads as silence, so the emulation never waits on the
+ * decoder; the play thread waits for it instead, so a seek or track start
+ * delays the first buffer by one sector's decode rather than dropping it.
+ */
+#define STREAM_RING			32		// sectors, power of 2
+#define STREAM_STACK_SIZE	(16 * 1024)
+
+static struct {
+	lwp_t thread;
+	mutex_t lock;
+	cond_t cond;
+	cond_t filled;		// signalled when a sector is decoded or the worker stops
+	boolean running;
+	boolean quit;
+	boolean active;		// the worker has sectors left to decode
+	int seek;			// sector the worker is sent to, -1 if none
+	int sector;			// sector at the tail
+	u32 head, tail;		// decoded / taken sectors
+	unsigned char ring[STREAM_RING][CD_FRAMESIZE_RAW];
+} stream;
+
+static char stream_stack[STREAM_STACK_SIZE];
+
+// the worker's file
+static int streamTrack = 0;
+static FlacFile *streamFlac = NULL;
+static FILE *streamRaw = NULL;
+static int streamNext = -1;		// sector read next without a seek
+
+// The track whose file holds the sector, 0 if it's in the image
+static int TrackOfSector(int sector) {
+	int i;
+
+	for (i = 1; i <= numtracks; i++) {
+		if (ti[i].file != NULL && sector >= (int)ti[i].fileStart &&
+				sector < (int)(ti[i].fileStart + ti[i].fileLen))
+			return i;
+	}
+	return 0;
+}
+
+static void CloseStreamFile(void) {
+	FlacClose(streamFlac);
+	streamFlac = NULL;
+	if (streamRaw != NULL) fclose(streamRaw);
+	streamRaw = NULL;
+	streamTrack = 0;
+	streamNext = -1;
+}
+
+// Decodes a sector, FALSE if it's in none of the files
+static boolean ReadStreamSector(int sector, unsigned char *buf) {
+	int track = TrackOfSector(sector), n;
+	struct trackinfo *t = &ti[track];
+
+	if (track == 0) return FALSE;
+
+	if (streamTrack == 0 || strcmp(ti[streamTrack].file, t->file)) {
+		CloseStreamFile();
+		if (t->format == TRACK_FLAC) streamFlac = FlacOpen(t->file);
+		else streamRaw = fopen(t->file, "rb");
+		if (streamFlac == NULL && streamRaw == NULL) return FALSE;
+		streamTrack = track;
+	}
+
+	if (sector != streamNext) {
+		if (streamFlac != NULL) n = FlacSeek(streamFlac, (sector - t->fileStart) * (CD_FRAMESIZE_RAW / 4));
+		else n = fseek(streamRaw, t->offset + (sector - t->fileStart) * CD_FRAMESIZE_RAW, SEEK_SET);
+		if (n != 0) {
+			memset(buf, 0, CD_FRAMESIZE_RAW);
+			streamNext = -1;
+			return TRUE;
+		}
+	}
+
+	if (streamFlac != NULL) n = FlacRead(streamFlac, buf, CD_FRAMESIZE_RAW / 4) * 4;
+	else n = fread(buf, 1, CD_FRAMESIZE_RAW, streamRaw);
+	memset(buf + n, 0, CD_FRAMESIZE_RAW - n);
+	streamNext = sector + 1;
+	return TRUE;
+}
+
+static void *streamthread(void *param) {
+	int sector = 0;
+	boolean ok;
+	u32 slot;
+
+	LWP_MutexLock(stream.lock);
+	while (!stream.quit) {
+		if (stream.seek >= 0) {
+			sector = stream.sector = stream.seek;
+			stream.seek = -1;
+			stream.head = stream.tail = 0;
+			stream.active = TRUE;
+			continue;
+		}
+		if (!stream.active || stream.head - stream.tail == STREAM_RING) {
+			LWP_CondWait(stream.cond, stream.lock);
+			continue;
+		}
+
+		slot = stream.head & (STREAM_RING - 1);
+		LWP_MutexUnlock(stream.lock);
+		ok = ReadStreamSector(sector, stream.ring[slot]);
+		LWP_MutexLock(stream.lock);
+
+		// dropped if the worker was sent elsewhere meanwhile
+		if (stream.seek < 0) {
+			if (ok) {
+				stream.head++;
+				sector++;
+			}
+			else stream.active = FALSE;
+			LWP_CondSignal(stream.filled);
+		}
+	}
+	stream.active = FALSE;
+	LWP_CondSignal(stream.filled);
+	LWP_MutexUnlock(stream.lock);
+
+	CloseStreamFile();
+	return NULL;
+}
+
+static int StartStream(void) {
+	LWP_MutexInit(&stream.lock, FALSE);
+	LWP_CondInit(&stream.cond);
+	LWP_CondInit(&stream.filled);
+	stream.quit = FALSE;
+	stream.active = FALSE;
+	stream.seek = -1;
+	stream.head = stream.tail = 0;
+
+	if (LWP_CreateThread(&stream.thread, streamthread, NULL,
+						 stream_stack, STREAM_STACK_SIZE, PLAY_PRIORITY) < 0) {
+		LWP_CondDestroy(stream.filled);
+		LWP_CondDestroy(stream.cond);
+		LWP_MutexDestroy(stream.lock);
+		return -1;
+	}
+	stream.running = TRUE;
+	return 0;
+}
+
+static void StopStream(void) {
+	if (!stream.running) return;
+
+	LWP_MutexLock(stream.lock);
+	stream.quit = TRUE;
+	LWP_CondSignal(stream.cond);
+	LWP_MutexUnlock(stream.lock);
+	LWP_JoinThread(stream.thread, NULL);
+
+	LWP_CondDestroy(stream.filled);
+	LWP_CondDestroy(stream.cond);
+	LWP_MutexDestroy(stream.lock);
+	stream.running = FALSE;
+}
+
+// Takes a sector of a track file from the ring. With wait set a sector the
+// worker hasn't decoded yet is waited for, otherwise it reads as silence.
+static void GetStreamSector(int sector, unsigned char *buffer, boolean wait) {
+	boolean first = TRUE;
+	int from;
+
+	if (!stream.running && StartStream() != 0) {
+		memset(buffer, 0, CD_FRAMESIZE_RAW);
+		return;
+	}
+
+	LWP_MutexLock(stream.lock);
+	for (;;) {
+		if (stream.seek < 0 && sector >= stream.sector && sector < stream.sector + (int)(stream.head - stream.tail)) {
+			stream.tail += sector - stream.sector;
+			memcpy(buffer, stream.ring[stream.tail & (STREAM_RING - 1)], CD_FRAMESIZE_RAW);
+			stream.tail++;
+			stream.sector = sector + 1;
+			LWP_CondSignal(stream.cond);
+			break;
+		}
+
+		// leave the worker alone if it's about to get there
+		from = stream.seek >= 0 ? stream.seek : stream.sector;
+		if (first && (!(stream.active || stream.seek >= 0) || sector < from || sector >= from + STREAM_RING)) {
+			stream.seek = from = sector;
+			LWP_CondSignal(stream.cond);
+		}
+		first = FALSE;
+
+		// only wait while the worker is still on its way to the sector; it
+		// may have failed, or ISOreadCDDA may have sent it elsewhere
+		if (!wait || sector < from || sector >= from + STREAM_RING ||
+				!(stream.seek >= 0 || (stream.active && stream.head - stream.tail < STREAM_RING))) {
+			memset(buffer, 0, CD_FRAMESIZE_RAW);
+			break;
+		}
+		LWP_CondWait(stream.filled, stream.lock);
+	}
+	LWP_MutexUnlock(stream.lock);
+}
+
+static void FreeTrackFiles(void) {
+	int i;
+
+	StopStream();
+	for (i = 1; i < MAXTRACKS; i++) {
+		free(ti[i].file);
+		ti[i].file = NULL;
+	}
+}
+
+// Path of a cue sheet FILE, relative ones are next to the cue sheet
+static int TrackFilePath(const char *cuename, const char *line, char *path) {
+	char name[256];
+	const char *sep;
+	int len;
+
+	line = strstr(line, "FILE");
+	if (sscanf(line, "FILE \"%255[^\"]\"", name) != 1 && sscanf(line, "FILE %255s", name) != 1)
+		return -1;
+
+	if (name[0] == '/' || strchr(name, ':') != NULL) {
+		snprintf(path, MAXPATHLEN, "%s", name);
+		return 0;
+	}
+	sep = strrchr(cuename, '/');
+	len = sep != NULL ? sep - cuename + 1 : 0;
+	snprintf(path, MAXPATHLEN, "%.*s%s", len, cuename, name);
+	return 0;
+}
+
+// Size in sectors of an audio track file, and where its samples start
+static int ProbeTrackFile(const char *name, int *format, unsigned int *offset, unsigned int *sectors) {
+	const char *ext = strrchr(name, '.');
+	unsigned int size;
+	u8 hdr[12];
+	FILE *f;
+
+	*offset = 0;
+	if (ext != NULL && !strnicmp(ext, ".flac", 6)) {
+		FlacFile *flac = FlacOpen(name);
+
+		if (flac == NULL) return -1;
+		*format = TRACK_FLAC;
+		*sectors = (FlacSamples(flac) + CD_FRAMESIZE_RAW / 4 - 1) / (CD_FRAMESIZE_RAW / 4);
+		FlacClose(flac);
+		return 0;
+	}
+
+	f = fopen(name, "rb");
+	if (f == NULL) return -1;
+	*format = TRACK_RAW;
+
+	if (fread(hdr, 1, 12, f) == 12 && !memcmp(hdr, "RIFF", 4) && !memcmp(hdr + 8, "WAVE", 4)) {
+		// the samples are the "data" chunk
+		size = 0;
+		while (fread(hdr, 1, 8, f) == 8) {
+			size = hdr[4] | (hdr[5] << 8) | (hdr[6] << 16) | ((u32)hdr[7] << 24);
+			if (!memcmp(hdr, "data", 4)) break;
+			fseek(f, (size + 1) & ~1, SEEK_CUR);
+			size = 0;
+		}
+		*offset = ftell(f);
+	}
+	else {
+		fseek(f, 0, SEEK_END);
+		size = ftell(f);
+	}
+	fclose(f);
+
+	*sectors = (size + CD_FRAMESIZE_RAW - 1) / CD_FRAMESIZE_RAW;
+	return 0;
+}
+
 u16 *iso_play_cdbuf;
 u16 iso_play_bufptr;
 
@@ -202,13 +508,19 @@ static void *playthread(void *param)
 			}
 		}
 		else {
-			s = fread(sndbuffer, 1, sizeof(sndbuffer), cddaHandle);
-
 			sec = cddaCurOffset / CD_FRAMESIZE_RAW;
 
+			if (TrackOfSector(sec)) {
+				for (i = 0; i < sizeof(sndbuffer) / CD_FRAMESIZE_RAW; i++)
+					GetStreamSector(sec + i, sndbuffer + CD_FRAMESIZE_RAW * i, TRUE);
+				s = sizeof(sndbuffer);
+			}
+			else s = fread(sndbuffer, 1, sizeof(sndbuffer), cddaHandle);
+
 			if (subHandle != NULL) {
 				fseek(subHandle, sec * SUB_FRAMESIZE, SEEK_SET);
 				fread(subbuffer, 1, SUB_FRAMESIZE, subHandle);
+				subSector = -1;
 			}
 		}
 
@@ -451,7 +763,9 @@ static int parsecue(const char *isofile) {
 	char			time[20];
 	char			*tmp;
 	char			linebuf[256], dummy[256];
-	unsigned int	t;
+	char			filename[MAXPATHLEN];
+	unsigned int	t, fileBase = 0, fileLen, offset = 0;
+	int				files = 0, format = TRACK_RAW;
 
 	numtracks = 0;
 
@@ -484,6 +798,12 @@ static int parsecue(const char *isofile) {
 
 	memset(&ti, 0, sizeof(ti));
 
+	// INDEX times are from the start of their FILE; the first one is the
+	// image, later ones hold audio tracks and follow it on the disc
+	fseek(cdHandle, 0, SEEK_END);
+	fileLen = ftell(cdHandle) / CD_FRAMESIZE_RAW;
+	filename[0] = '\0';
+
 	while (fgets(linebuf, sizeof(linebuf), fi) != NULL) {
 		strncpy(dummy, linebuf, sizeof(linebuf));
 		token = strtok(dummy, " ");
@@ -492,7 +812,18 @@ static int parsecue(const char *isofile) {
 			continue;
 		}
 
-		if (!strcmp(token, "TRACK")){
+		if (!strcmp(token, "FILE")) {
+			if (files++ == 0) continue;
+
+			fileBase += fileLen;
+			fileLen = 0;
+			if (TrackFilePath(cuename, linebuf, filename) != 0 ||
+					ProbeTrackFile(filename, &format, &offset, &fileLen) != 0) {
+				SysPrintf("[-%s]", filename);
+				filename[0] = '\0';
+			}
+		}
+		else if (!strcmp(token, "TRACK")){
 			numtracks++;
 
 			if (strstr(linebuf, "AUDIO") != NULL) {
@@ -501,6 +832,14 @@ static int parsecue(const char *isofile) {
 			else if (strstr(linebuf, "MODE1/2352") != NULL || strstr(linebuf, "MODE2/2352") != NULL) {
 				ti[numtracks].type = DATA;
 			}
+
+			if (files > 1 && filename[0] != '\0' && ti[numtracks].type == CDDA) {
+				ti[numtracks].file = strdup(filename);
+				ti[numtracks].format = format;
+				ti[numtracks].offset = offset;
+				ti[numtracks].fileStart = fileBase;
+				ti[numtracks].fileLen = fileLen;
+			}
 		}
 		else if (!strcmp(token, "INDEX")) {
 			tmp = strstr(linebuf, "INDEX");
@@ -512,7 +851,7 @@ static int parsecue(const char *isofile) {
 
 			tok2msf((char *)&time, (char *)&ti[numtracks].start);
 
-			t = msf2sec(ti[numtracks].start) + 2 * 75;
+			t = msf2sec(ti[numtracks].start) + fileBase + 2 * 75;
 			sec2msf(t, ti[numtracks].start);
 
 			// If we've already seen another track, this is its end
@@ -527,8 +866,7 @@ static int parsecue(const char *isofile) {
 
 	// Fill out the last track's end based on size
 	if (numtracks >= 1) {
-		fseek(cdHandle, 0, SEEK_END);
-		t = ftell(cdHandle) / 2352 - msf2sec(ti[numtracks].start) + 2 * 75;
+		t = fileBase + fileLen - msf2sec(ti[numtracks].start) + 2 * 75;
 		sec2msf(t, ti[numtracks].length);
 	}
 
@@ -721,7 +1059,94 @@ long CALLBACK ISOinit(void) {
 	return 0; // do nothing
 }
 
+#ifdef CDRISO_MMAP
+static void MapImage(void) {
+	long size;
+	void *map;
+
+	fseek(cdHandle, 0, SEEK_END);
+	size = ftell(cdHandle);
+	fseek(cdHandle, 0, SEEK_SET);
+	if (size < CD_FRAMESIZE_RAW) return;
+
+	map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno(cdHandle), 0);
+	if (map == MAP_FAILED) return;
+	madvise(map, size, MADV_SEQUENTIAL);
+
+	cdMap = (unsigned char *)map;
+	cdMapSize = size;
+	prefetchEnd = prefetchLen = 0;
+}
+
+static void UnmapImage(void) {
+	if (cdMap != NULL) {
+		cdrDetachTransfer();	// CdRom.c may still point into the mapping
+		munmap(cdMap, cdMapSize);
+		cdMap = NULL;
+		cdMapSize = 0;
+	}
+	cdMapSector = NULL;
+}
+
+static void PrefetchSectors(unsigned int sector, unsigned int count) {
+	size_t start = (size_t)sector * CD_FRAMESIZE_RAW;
+	size_t len = (size_t)count * CD_FRAMESIZE_RAW;
+	long page = sysconf(_SC_PAGESIZE);
+
+	if (start >= cdMapSize) return;
+	if (len > cdMapSize - start) len = cdMapSize - start;
+	// madvise wants a page aligned start
+	len += start & (page - 1);
+	start &= ~(size_t)(page - 1);
+	madvise(cdMap + start, len, MADV_WILLNEED);
+	prefetchEnd = sector + count;
+}
+
+// Points cdMapSector at the sector, FALSE if it's past the end of the image
+static boolean MapSector(unsigned int sector) {
+	if (cdMap == NULL || sector >= cdMapSize / CD_FRAMESIZE_RAW) return FALSE;
+
+	cdMapSector = cdMap + (size_t)sector * CD_FRAMESIZE_RAW;
+	// Keep the kernel one window ahead of a sequential read
+	if (prefetchLen && sector + prefetchLen / 2 >= prefetchEnd && sector < prefetchEnd)
+		PrefetchSectors(prefetchEnd, prefetchLen);
+	return TRUE;
+}
+#endif
+
+// Tells the backend a read of about this many sectors starts at time (MSF),
+// so a mapped image can have the pages in before the CPU asks for them
+void cdrIsoPrefetch(const unsigned char *time, int sectors) {
+#ifdef CDRISO_MMAP
+	if (cdMap == NULL || sectors <= 0) return;
+	prefetchLen = sectors;
+	PrefetchSectors(MSF2SECT(time[0], time[1], time[2]), sectors);
+#endif
+}
+
+// The sector's raw data in the mapped image, NULL if it isn't mapped
+unsigned char *cdrIsoMappedSector(int sector) {
+#ifdef CDRISO_MMAP
+	if (cdMap != NULL && sector >= 0 && (unsigned int)sector < cdMapSize / CD_FRAMESIZE_RAW)
+		return cdMap + (size_t)sector * CD_FRAMESIZE_RAW;
+#endif
+	return NULL;
+}
+
+// TRUE while ISOgetBuffer points into the mapped image rather than cdbuffer;
+// such a sector stays valid until the image is closed
+int cdrIsoMapped(void) {
+#ifdef CDRISO_MMAP
+	return cdMapSector != NULL;
+#else
+	return FALSE;
+#endif
+}
+
 long CALLBACK ISOshutdown(void) {
+#ifdef CDRISO_MMAP
+	UnmapImage();
+#endif
 	if (cdHandle != NULL) {
 		fclose(cdHandle);
 		cdHandle = NULL;
@@ -730,7 +1155,9 @@ long CALLBACK ISOshutdown(void) {
 		fclose(subHandle);
 		subHandle = NULL;
 	}
+	subSector = -1;
 	stopCDDA();
+	FreeTrackFiles();
 	return 0;
 }
 
@@ -792,6 +1219,15 @@ long CALLBACK ISOopen(void) {
 		SysPrintf("[+sub]");
 	}
 
+#ifdef CDRISO_MMAP
+	if (!subChanMixed && !isMode1ISO) {
+		MapImage();
+		if (cdMap != NULL) SysPrintf("[+mmap]");
+		// the patches are laid in by BuildPPFCache once CheckCdrom knows
+		// which disc this is; the table may still hold the previous one's
+	}
+#endif
+
 	SysPrintf(".\n");
 
 	PrintTracks();
@@ -800,6 +1236,9 @@ long CALLBACK ISOopen(void) {
 }
 
 long CALLBACK ISOclose(void) {
+#ifdef CDRISO_MMAP
+	UnmapImage();
+#endif
 	if (cdHandle != NULL) {
 		fclose(cdHandle);
 		cdHandle = NULL;
@@ -808,7 +1247,9 @@ long CALLBACK ISOclose(void) {
 		fclose(subHandle);
 		subHandle = NULL;
 	}
+	subSector = -1;
 	stopCDDA();
+	FreeTrackFiles();
 	return 0;
 }
 
@@ -898,15 +1339,20 @@ void setReadAhead(int r) {
 // time: byte 0 - minute; byte 1 - second; byte 2 - frame
 // uses bcd format
 long CALLBACK ISOreadTrack(unsigned char *time) {
+	int sector = MSF2SECT(btoi(time[0]), btoi(time[1]), btoi(time[2]));
+
 	if (cdHandle == NULL) {
 		return -1;
 	}
 #ifdef PROFILE
 	start_section(CDR_SECTION);
 #endif
+#ifdef CDRISO_MMAP
+	cdMapSector = NULL;
+#endif
 
 	if (subChanMixed) {
-		fseek(cdHandle, MSF2SECT(btoi(time[0]), btoi(time[1]), btoi(time[2])) * (CD_FRAMESIZE_RAW + SUB_FRAMESIZE), SEEK_SET);
+		fseek(cdHandle, sector * (CD_FRAMESIZE_RAW + SUB_FRAMESIZE), SEEK_SET);
 		print_gecko("subchanmixed read\r\n");
 		fread(cdbuffer, 1, DATA_SIZE, cdHandle);
 		fread(subbuffer, 1, SUB_FRAMESIZE, cdHandle);
@@ -916,16 +1362,22 @@ long CALLBACK ISOreadTrack(unsigned char *time) {
 	else {
 		if(isMode1ISO) {
 			print_gecko("isMode1ISO read\r\n");
-			fseek(cdHandle, MSF2SECT(btoi(time[0]), btoi(time[1]), btoi(time[2])) * MODE1_DATA_SIZE, SEEK_SET);
+			fseek(cdHandle, sector * MODE1_DATA_SIZE, SEEK_SET);
 			fread(cdbuffer + 12, 1, MODE1_DATA_SIZE, cdHandle);
 			memset(cdbuffer, 0, 12); //not really necessary, fake mode 2 header
 			cdbuffer[0] = (time[0]);
 			cdbuffer[1] = (time[1]);
 			cdbuffer[2] = (time[2]);
 			cdbuffer[3] = 1; //mode 1
-		} else {
+		}
+#ifdef CDRISO_MMAP
+		else if (MapSector(sector)) {
+			// nothing to copy, the patches are already in the mapping
+		}
+#endif
+		else {
 			//print_gecko("!isMode1ISO read from %08X\r\n", offset);
-			unsigned int offset = MSF2SECT(btoi(time[0]), btoi(time[1]), btoi(time[2])) * CD_FRAMESIZE_RAW;
+			unsigned int offset = sector * CD_FRAMESIZE_RAW;
 			if(readAheadMisses > 2) setReadAhead(0);
 			if(readAhead) {
 				if(offset >= readAheadOffset && offset+CD_FRAMESIZE_RAW < readAheadOffset+CDREADAHEAD_SIZE) {
@@ -950,14 +1402,11 @@ long CALLBACK ISOreadTrack(unsigned char *time) {
 			}
 		}
 
-		if (subHandle != NULL) {
-			print_gecko("subHandle read\r\n");
-			fseek(subHandle, MSF2SECT(btoi(time[0]), btoi(time[1]), btoi(time[2])) * SUB_FRAMESIZE, SEEK_SET);
-			fread(subbuffer, 1, SUB_FRAMESIZE, subHandle);
-
-			if (subChanRaw) DecodeRawSubData();
-		}
+		// only read when someone asks for it, most reads never do
+		if (subHandle != NULL) subSector = sector;
 	}
+
+	if (!cdrIsoMapped()) ApplyPPFSector(cdbuffer + 12, sector);
 #ifdef PROFILE
 	end_section(CDR_SECTION);
 #endif
@@ -966,6 +1415,9 @@ long CALLBACK ISOreadTrack(unsigned char *time) {
 
 // return readed track
 unsigned char * CALLBACK ISOgetBuffer(void) {
+#ifdef CDRISO_MMAP
+	if (cdMapSector != NULL) return cdMapSector+12;
+#endif
 	return cdbuffer+12;
 }
 
@@ -992,6 +1444,14 @@ long CALLBACK ISOstop(void) {
 
 // gets subchannel data
 unsigned char* CALLBACK ISOgetBufferSub(void) {
+	if (subHandle != NULL && subSector >= 0) {
+		fseek(subHandle, subSector * SUB_FRAMESIZE, SEEK_SET);
+		fread(subbuffer, 1, SUB_FRAMESIZE, subHandle);
+		subSector = -1;
+
+		if (subChanRaw) DecodeRawSubData();
+	}
+
 	if (subHandle != NULL || subChanMixed) {
 		return subbuffer;
 	}
@@ -1033,6 +1493,14 @@ long CALLBACK ISOreadCDDA(unsigned char m, unsigned char s, unsigned char f, uns
 	msf[1] = itob(msf[1]);
 	msf[2] = itob(msf[2]);
 
+	if (TrackOfSector(MSF2SECT(m, s, f))) {
+		GetStreamSector(MSF2SECT(m, s, f), buffer, FALSE);
+#ifdef PROFILE
+		end_section(CDR_SECTION);
+#endif
+		return 0;
+	}
+
 	if (ISOreadTrack(msf) != 0) return -1;
 
 	p = ISOgetBuffer();
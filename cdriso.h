@@ -27,6 +27,9 @@ extern "C" {
 
 void cdrIsoInit(void);
 int cdrIsoActive(void);
+int cdrIsoMapped(void);
+void cdrIsoPrefetch(const unsigned char *time, int sectors);
+unsigned char *cdrIsoMappedSector(int sector);
 
 #ifdef __cplusplus
 }
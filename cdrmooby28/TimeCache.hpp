@@ -2,29 +2,50 @@
 #define TIMECACHE_HPP
 
 #include "CDTime.hpp"
-#include <map>
-#include <list>
+#include <vector>
 
 /*
  * This is an LRU cache for any type of file data this plugin can store.
  * It's a map of time to data...
+ *
+ * The items live in a flat pool that's never reallocated between
+ * setMaxSize calls, threaded on an LRU list by index.  Lookups go through
+ * an open-addressed table of pool indices keyed on the absolute frame, so
+ * a find or insert doesn't allocate and evicting the oldest item is O(1).
  */
 
 template <class Data>
 class TimeCache
 {
 public:
-   TimeCache() : maxSize(10) {}
+   TimeCache() : maxSize(0), used(0), head(-1), tail(-1) { setMaxSize(10); }
 
-   TimeCache(size_t size) { setMaxSize(size); }
+   TimeCache(size_t size) : maxSize(0), used(0), head(-1), tail(-1)
+   { setMaxSize(size); }
 
    TimeCache& setMaxSize(size_t size)
    { 
-      maxSize = size; 
-      if (maxSize < 1)
-         maxSize = 1;
-      while (cache.size() > maxSize)
-         popOne(); 
+      if (size < 1)
+         size = 1;
+      if (size == maxSize)
+         return *this;
+
+         // keep the most recent items that still fit
+      std::vector<Item> keep;
+      for (int i = head; i != -1 && keep.size() < size; i = pool[i].next)
+         keep.push_back(pool[i]);
+
+      maxSize = size;
+      pool.assign(maxSize, Item());
+      size_t tableSize = 1;
+      while (tableSize < maxSize * 2)
+         tableSize <<= 1;
+      table.assign(tableSize, -1);
+      head = tail = -1;
+      used = 0;
+
+      for (size_t i = keep.size(); i > 0; i--)
+         insert(keep[i - 1].time, keep[i - 1].data);
       return *this; 
    }
 
@@ -34,56 +55,121 @@ public:
       // return true if found (and set Data d)
    bool find (const CDTime& time, Data& d)
    {
-         // try to find the data in the cache first
          // if it's there, return it and set it as the most recent
-      typename CacheMap::iterator itr = cache.find(time);
-      if (itr != cache.end())
+      int i = lookup(time);
+      if (i == -1)
+         return false;
+      d = pool[i].data;
+      unlink(i);
+      pushFront(i);
+      return true;
+   }
+
+      // insert this as the LRU data
+   void insert(const CDTime& time, const Data& d)
+   {
+      int i = lookup(time);
+      if (i != -1)
+      {
+         pool[i].data = d;
+         unlink(i);
+         pushFront(i);
+         return;
+      }
+
+         // are we full?  reuse the oldest item's pool entry
+      if (used >= maxSize)
       {
-         d = (*itr).second.first;
-            // splice will move the item in the LRUList to the front and
-            // keep the iterator valid
-         order.splice(order.begin(), order, 
-            (*itr).second.second, (*itr).second.second); 
-         return true;
+         i = tail;
+         removeKey(pool[i].time);
+         unlink(i);
       }
       else
       {
-         return false;
+         i = (int)used++;
       }
+
+      pool[i].time = time;
+      pool[i].data = d;
+      pushFront(i);
+      table[probe(time)] = i;
    }
 
-      // insert this as the LRU data
-   void insert(const CDTime& time, const Data& d)
+private:
+   struct Item
    {
-         // are we full?  push out the oldest data
-      while (cache.size() >= maxSize)
-         popOne();
+      Item() : prev(-1), next(-1) {}
+      CDTime time;
+      Data data;
+      int prev, next;
+   };
 
-      order.push_front(time);
-      cache[time] = CacheItem(d, order.begin());
+   size_t hash(const CDTime& time) const
+   { return (size_t)(time.getAbsoluteFrame() * 2654435761u) & (table.size() - 1); }
+
+      // the table slot holding time, or the empty slot where it would go
+   size_t probe(const CDTime& time) const
+   {
+      size_t s = hash(time);
+      while (table[s] != -1 && !(pool[table[s]].time == time))
+         s = (s + 1) & (table.size() - 1);
+      return s;
    }
 
-private:
-      // remove the oldest item from the cache
-   void popOne()
+   int lookup(const CDTime& time) const
+   { return table[probe(time)]; }
+
+      // backward shift deletion, so the table never fills with tombstones
+   void removeKey(const CDTime& time)
+   {
+      size_t mask = table.size() - 1;
+      size_t hole = probe(time);
+      size_t s = hole;
+      table[hole] = -1;
+      for (;;)
+      {
+         s = (s + 1) & mask;
+         if (table[s] == -1)
+            return;
+         size_t home = hash(pool[table[s]].time);
+            // move it back if its home isn't between the hole and here
+         if (((s - home) & mask) >= ((s - hole) & mask))
+         {
+            table[hole] = table[s];
+            table[s] = -1;
+            hole = s;
+         }
+      }
+   }
+
+   void unlink(int i)
+   {
+      if (pool[i].prev != -1) pool[pool[i].prev].next = pool[i].next;
+      else head = pool[i].next;
+      if (pool[i].next != -1) pool[pool[i].next].prev = pool[i].prev;
+      else tail = pool[i].prev;
+      pool[i].prev = pool[i].next = -1;
+   }
+
+   void pushFront(int i)
    {
-      CDTime toast = order.back();
-      order.pop_back();
-      cache.erase(cache.find(toast));
+      pool[i].prev = -1;
+      pool[i].next = head;
+      if (head != -1) pool[head].prev = i;
+      head = i;
+      if (tail == -1) tail = i;
    }
 
-   // maxSizeimum size of the cache
+   // maximum size of the cache
    size_t maxSize;
+   size_t used;
 
-      // the list is ordered from first to last starting with
-      // the most recently used data item.
-   typedef std::list<CDTime> LRUList;
-   LRUList order;
+      // the list runs from head (most recently used) to tail
+   std::vector<Item> pool;
+   int head, tail;
 
-      // the map simply holds the time and data pairs
-   typedef std::pair<Data, LRUList::iterator> CacheItem;
-   typedef std::map<CDTime, CacheItem > CacheMap;
-   CacheMap cache;
+      // open-addressed, pool indices or -1 for empty
+   std::vector<int> table;
 };
 
 #endif // TIMECACHE_HPP
@@ -31,12 +31,16 @@ int NumCodes = 0;
 static int NumCodesAllocated = 0;
 
 s8 *prevM = NULL;
-u32 *SearchResults = NULL;
 int NumSearchResults = 0;
-static int NumSearchResultsAllocated = 0;
+
+#define SEARCH_WORDS		(0x200000 / 32)
+
+static u32 *SearchBits = NULL;
 
 #define ALLOC_INCREMENT		100
 
+static void CompileCheats();
+
 void ClearAllCheats() {
 	int i;
 
@@ -58,6 +62,8 @@ void ClearAllCheats() {
 	CheatCodes = NULL;
 	NumCodes = 0;
 	NumCodesAllocated = 0;
+
+	CompileCheats();
 }
 
 // load cheats from the specific filename
@@ -144,6 +150,8 @@ void LoadCheats(const char *filename) {
 
 	fclose(fp);
 
+	CompileCheats();
+
 	SysPrintf(_("Cheats loaded from: %s\n"), filename);
 }
 
@@ -179,129 +187,238 @@ void SaveCheats(const char *filename) {
 	SysPrintf(_("Cheats saved to: %s\n"), filename);
 }
 
-// apply all enabled cheats
-void ApplyCheats() {
-	int		i, j, k, endindex;
+/*
+* The enabled cheats are compiled into CheatProgram whenever they change,
+* so ApplyCheats doesn't decode the code words every frame. Each op holds
+* the host address it touches in psxM, constant writes have their value
+* pre-swapped, decrements become increments, and SLIDE codes are unrolled
+* into plain writes. A conditional that fails skips the ops compiled from
+* the code after it.
+*/
+
+enum {
+	CHEATOP_SET8 = 0,
+	CHEATOP_SET16,
+	CHEATOP_ADD8,
+	CHEATOP_ADD16,
+	CHEATOP_COPY,
+	CHEATOP_EQU8,
+	CHEATOP_NOTEQU8,
+	CHEATOP_LESSTHAN8,
+	CHEATOP_GREATERTHAN8,
+	CHEATOP_EQU16,
+	CHEATOP_NOTEQU16,
+	CHEATOP_LESSTHAN16,
+	CHEATOP_GREATERTHAN16
+};
+
+typedef struct {
+	u8			op;
+	u16			val;
+	int			skip;		// ops to skip when a conditional fails
+	u8			*ptr;		// host address the op reads or writes
+	u32			src, dst;	// CHEATOP_COPY offsets in psxM
+} CheatOp;
+
+static CheatOp *CheatProgram = NULL;
+static int NumCheatOps = 0;
+static int NumCheatOpsAllocated = 0;
+
+static CheatOp *CheatEmit(int op, u32 addr, u16 val) {
+	CheatOp *o;
+
+	if (NumCheatOps >= NumCheatOpsAllocated) {
+		NumCheatOpsAllocated += ALLOC_INCREMENT;
+		CheatProgram = (CheatOp *)realloc(CheatProgram, sizeof(CheatOp) * NumCheatOpsAllocated);
+	}
+
+	o = &CheatProgram[NumCheatOps++];
+	o->op = op;
+	o->skip = 0;
+	o->val = val;
+	o->ptr = (u8 *)&psxCore.psxM[addr & 0x1fffff];
+	o->src = o->dst = 0;
+	return o;
+}
+
+// Compiles the code at index j of a cheat ending at endindex, and returns
+// the index of the next code
+static int CompileCheatCode(int j, int endindex) {
+	u8		type = (uint8_t)(CheatCodes[j].Addr >> 24);
+	u32		addr = (CheatCodes[j].Addr & 0x001FFFFF);
+	u16		val = CheatCodes[j].Val;
+	u32		taddr;
+	u16		tval;
+	int		k;
+	CheatOp	*o;
+
+	switch (type) {
+		case CHEAT_CONST8:
+			CheatEmit(CHEATOP_SET8, addr, (u8)val);
+			break;
+
+		case CHEAT_CONST16:
+			CheatEmit(CHEATOP_SET16, addr, SWAPu16(val));
+			break;
+
+		case CHEAT_INC16:
+			CheatEmit(CHEATOP_ADD16, addr, val);
+			break;
+
+		case CHEAT_DEC16:
+			CheatEmit(CHEATOP_ADD16, addr, (u16)-val);
+			break;
+
+		case CHEAT_INC8:
+			CheatEmit(CHEATOP_ADD8, addr, (u8)val);
+			break;
+
+		case CHEAT_DEC8:
+			CheatEmit(CHEATOP_ADD8, addr, (u8)-val);
+			break;
+
+		case CHEAT_SLIDE:
+			if (j + 1 >= endindex)
+				break;
+
+			type = (uint8_t)(CheatCodes[j + 1].Addr >> 24);
+			taddr = (CheatCodes[j + 1].Addr & 0x001FFFFF);
+			tval = CheatCodes[j + 1].Val;
+
+			if (type == CHEAT_CONST8 || type == CHEAT_CONST16) {
+				for (k = 0; k < ((addr >> 8) & 0xFF); k++) {
+					if (type == CHEAT_CONST8)
+						CheatEmit(CHEATOP_SET8, taddr, (u8)tval);
+					else
+						CheatEmit(CHEATOP_SET16, taddr, SWAPu16(tval));
+					taddr += (s8)(addr & 0xFF);
+					tval += (s8)(val & 0xFF);
+				}
+			}
+			return j + 2;
+
+		case CHEAT_MEMCPY:
+			if (j + 1 >= endindex)
+				break;
+
+			o = CheatEmit(CHEATOP_COPY, 0, val);
+			o->src = addr;
+			o->dst = (CheatCodes[j + 1].Addr & 0x001FFFFF);
+			return j + 2;
+
+		case CHEAT_EQU8:
+		case CHEAT_NOTEQU8:
+		case CHEAT_LESSTHAN8:
+		case CHEAT_GREATERTHAN8:
+			CheatEmit(CHEATOP_EQU8 + (type - CHEAT_EQU8), addr, (u8)val);
+			break;
+
+		case CHEAT_EQU16:
+		case CHEAT_NOTEQU16:
+		case CHEAT_LESSTHAN16:
+		case CHEAT_GREATERTHAN16:
+			CheatEmit(CHEATOP_EQU16 + (type - CHEAT_EQU16), addr, val);
+			break;
+	}
+
+	return j + 1;
+}
+
+// rebuild the program after the cheats or their enabled state changed
+static void CompileCheats() {
+	int		i, j, endindex, first, cond;
+
+	NumCheatOps = 0;
 
 	for (i = 0; i < NumCheats; i++) {
 		if (!Cheats[i].Enabled) {
 			continue;
 		}
 
-		// process all cheat codes
 		endindex = Cheats[i].First + Cheats[i].n;
+		cond = -1;
+
+		for (j = Cheats[i].First; j < endindex; ) {
+			first = NumCheatOps;
+			j = CompileCheatCode(j, endindex);
+
+			// a failed conditional skips everything the next code compiled to
+			if (cond != -1) {
+				CheatProgram[cond].skip = NumCheatOps - first;
+			}
 
-		for (j = Cheats[i].First; j < endindex; j++) {
-			u8		type = (uint8_t)(CheatCodes[j].Addr >> 24);
-			u32		addr = (CheatCodes[j].Addr & 0x001FFFFF);
-			u16		val = CheatCodes[j].Val;
-			u32		taddr;
-
-			switch (type) {
-				case CHEAT_CONST8:
-					psxMu8ref(addr) = (u8)val;
-					break;
-
-				case CHEAT_CONST16:
-					psxMu16ref(addr) = SWAPu16(val);
-					break;
-
-				case CHEAT_INC16:
-					psxMu16ref(addr) = SWAPu16(psxMu16(addr) + val);
-					break;
-
-				case CHEAT_DEC16:
-					psxMu16ref(addr) = SWAPu16(psxMu16(addr) - val);
-					break;
-
-				case CHEAT_INC8:
-					psxMu8ref(addr) += (u8)val;
-					break;
-
-				case CHEAT_DEC8:
-					psxMu8ref(addr) -= (u8)val;
-					break;
-
-				case CHEAT_SLIDE:
-					j++;
-					if (j >= endindex)
-						break;
-
-					type = (uint8_t)(CheatCodes[j].Addr >> 24);
-					taddr = (CheatCodes[j].Addr & 0x001FFFFF);
-					val = CheatCodes[j].Val;
-
-					if (type == CHEAT_CONST8) {
-						for (k = 0; k < ((addr >> 8) & 0xFF); k++) {
-							psxMu8ref(taddr) = (u8)val;
-							taddr += (s8)(addr & 0xFF);
-							val += (s8)(CheatCodes[j - 1].Val & 0xFF);
-						}
-					}
-					else if (type == CHEAT_CONST16) {
-						for (k = 0; k < ((addr >> 8) & 0xFF); k++) {
-							psxMu16ref(taddr) = SWAPu16(val);
-							taddr += (s8)(addr & 0xFF);
-							val += (s8)(CheatCodes[j - 1].Val & 0xFF);
-						}
-					}
-					break;
-
-				case CHEAT_MEMCPY:
-					j++;
-					if (j >= endindex)
-						break;
-
-					taddr = (CheatCodes[j].Addr & 0x001FFFFF);
-					for (k = 0; k < val; k++) {
-						psxMu8ref(taddr + k) = PSXMu8(addr + k);
-					}
-					break;
-
-				case CHEAT_EQU8:
-					if (PSXMu8(addr) != (u8)val)
-						j++; // skip the next code
-					break;
-
-				case CHEAT_NOTEQU8:
-					if (PSXMu8(addr) == (u8)val)
-						j++; // skip the next code
-					break;
-
-				case CHEAT_LESSTHAN8:
-					if (PSXMu8(addr) >= (u8)val)
-						j++; // skip the next code
-					break;
-
-				case CHEAT_GREATERTHAN8:
-					if (PSXMu8(addr) <= (u8)val)
-						j++; // skip the next code
-					break;
-
-				case CHEAT_EQU16:
-					if (PSXMu16(addr) != val)
-						j++; // skip the next code
-					break;
-
-				case CHEAT_NOTEQU16:
-					if (PSXMu16(addr) == val)
-						j++; // skip the next code
-					break;
-
-				case CHEAT_LESSTHAN16:
-					if (PSXMu16(addr) >= val)
-						j++; // skip the next code
-					break;
-
-				case CHEAT_GREATERTHAN16:
-					if (PSXMu16(addr) <= val)
-						j++; // skip the next code
-					break;
+			cond = -1;
+			if (NumCheatOps == first + 1 && CheatProgram[first].op >= CHEATOP_EQU8) {
+				cond = first;
 			}
 		}
 	}
 }
 
+// apply all enabled cheats
+void ApplyCheats() {
+	const CheatOp	*o = CheatProgram, *end = CheatProgram + NumCheatOps;
+	u32				k;
+
+	for (; o < end; o++) {
+		switch (o->op) {
+			case CHEATOP_SET8:
+				*o->ptr = (u8)o->val;
+				break;
+
+			case CHEATOP_SET16:
+				*(u16 *)o->ptr = o->val;
+				break;
+
+			case CHEATOP_ADD8:
+				*o->ptr += (u8)o->val;
+				break;
+
+			case CHEATOP_ADD16:
+				*(u16 *)o->ptr = SWAPu16(SWAP16(*(u16 *)o->ptr) + o->val);
+				break;
+
+			case CHEATOP_COPY:
+				for (k = 0; k < o->val; k++) {
+					psxMu8ref(o->dst + k) = psxMu8(o->src + k);
+				}
+				break;
+
+			case CHEATOP_EQU8:
+				if (*o->ptr != (u8)o->val) o += o->skip;
+				break;
+
+			case CHEATOP_NOTEQU8:
+				if (*o->ptr == (u8)o->val) o += o->skip;
+				break;
+
+			case CHEATOP_LESSTHAN8:
+				if (*o->ptr >= (u8)o->val) o += o->skip;
+				break;
+
+			case CHEATOP_GREATERTHAN8:
+				if (*o->ptr <= (u8)o->val) o += o->skip;
+				break;
+
+			case CHEATOP_EQU16:
+				if (SWAP16(*(u16 *)o->ptr) != o->val) o += o->skip;
+				break;
+
+			case CHEATOP_NOTEQU16:
+				if (SWAP16(*(u16 *)o->ptr) == o->val) o += o->skip;
+				break;
+
+			case CHEATOP_LESSTHAN16:
+				if (SWAP16(*(u16 *)o->ptr) >= o->val) o += o->skip;
+				break;
+
+			case CHEATOP_GREATERTHAN16:
+				if (SWAP16(*(u16 *)o->ptr) <= o->val) o += o->skip;
+				break;
+		}
+	}
+}
+
 int AddCheat(const char *descr, char *code) {
 	int c = 1;
 	char *p1, *p2;
@@ -385,6 +502,16 @@ void RemoveCheat(int index) {
 	}
 
 	NumCheats--;
+
+	CompileCheats();
+}
+
+void EnableCheat(int index, int enabled) {
+	assert(index >= 0 && index < NumCheats);
+
+	Cheats[index].Enabled = enabled;
+
+	CompileCheats();
 }
 
 int EditCheat(int index, const char *descr, char *code) {
@@ -444,17 +571,18 @@ int EditCheat(int index, const char *descr, char *code) {
 	Cheats[index].First = prev;
 	Cheats[index].n = NumCodes - prev;
 
+	CompileCheats();
+
 	return 0;
 }
 
 void FreeCheatSearchResults() {
-	if (SearchResults != NULL) {
-		free(SearchResults);
+	if (SearchBits != NULL) {
+		free(SearchBits);
 	}
-	SearchResults = NULL;
+	SearchBits = NULL;
 
 	NumSearchResults = 0;
-	NumSearchResultsAllocated = 0;
 }
 
 void FreeCheatSearchMem() {
@@ -477,548 +605,208 @@ static void CheatSearchInitBackupMemory() {
 	}
 }
 
-static void CheatSearchAddResult(u32 addr) {
-	if (NumSearchResults >= NumSearchResultsAllocated) {
-		NumSearchResultsAllocated += ALLOC_INCREMENT;
-
-		if (SearchResults == NULL) {
-			SearchResults = (u32 *)malloc(sizeof(u32) * NumSearchResultsAllocated);
-		}
-		else {
-			SearchResults = (u32 *)realloc(SearchResults, sizeof(u32) * NumSearchResultsAllocated);
-		}
-	}
-
-	SearchResults[NumSearchResults++] = addr;
-}
-
-void CheatSearchEqual8(u8 val) {
-	u32 i, j;
+// Lists up to count results, starting with the first-th one
+int CheatSearchGetResults(u32 *addrs, int first, int count) {
+	u32 w, bits;
+	int n = 0;
 
-	CheatSearchInitBackupMemory();
+	if (SearchBits == NULL) return 0;
 
-	if (SearchResults == NULL) {
-		// search the whole memory
-		for (i = 0; i < 0x200000; i++) {
-			if (PSXMu8(i) == val) {
-				CheatSearchAddResult(i);
-			}
+	for (w = 0; w < SEARCH_WORDS && n < count; w++) {
+		bits = SearchBits[w];
+		if (first >= __builtin_popcount(bits)) {
+			first -= __builtin_popcount(bits);
+			continue;
 		}
-	}
-	else {
-		// only search within the previous results
-		j = 0;
+		while (bits && n < count) {
+			int k = __builtin_ctz(bits);
 
-		for (i = 0; i < NumSearchResults; i++) {
-			if (PSXMu8(SearchResults[i]) == val) {
-				SearchResults[j++] = SearchResults[i];
+			bits &= bits - 1;
+			if (first > 0) {
+				first--;
+				continue;
 			}
+			addrs[n++] = w * 32 + k;
 		}
-
-		NumSearchResults = j;
 	}
+
+	return n;
 }
 
-void CheatSearchEqual16(u16 val) {
-	u32 i, j;
+/*
+* The candidates are a bitset over RAM, bit k of SearchBits[w] standing for
+* address w * 32 + k. A first search starts from every address aligned to
+* its width; later ones only keep the candidates still matching.
+*
+* Each word of candidates is filtered by a branchless loop over its 32
+* bytes of RAM, and words with no candidates left are skipped outright, so
+* narrowing a handful of results doesn't touch the rest of memory.
+*/
+
+#define LOAD8(p, a)		((p)[a])
+#define LOAD16(p, a)	((p)[a] | ((p)[(a) + 1] << 8))
+#define LOAD32(p, a)	((p)[a] | ((p)[(a) + 1] << 8) | ((p)[(a) + 2] << 16) | ((u32)(p)[(a) + 3] << 24))
 
+static const u32 searchAlign[5] = { 0, 0xffffffff, 0x55555555, 0, 0x11111111 };
+
+static boolean CheatSearchStart(int width) {
 	CheatSearchInitBackupMemory();
 
-	if (SearchResults == NULL) {
-		// search the whole memory
-		for (i = 0; i < 0x200000; i += 2) {
-			if (PSXMu16(i) == val) {
-				CheatSearchAddResult(i);
-			}
-		}
-	}
-	else {
-		// only search within the previous results
-		j = 0;
+	if (SearchBits == NULL) {
+		u32 w;
+
+		SearchBits = (u32 *)malloc(SEARCH_WORDS * sizeof(u32));
+		if (SearchBits == NULL) return FALSE;
+		for (w = 0; w < SEARCH_WORDS; w++)
+			SearchBits[w] = searchAlign[width];
+	}
+	return TRUE;
+}
+
+// Keeps the candidates where cond holds, with cur the value at the address
+// and prev its value at the last backup
+#define CHEAT_SEARCH(width, load, cond) do { \
+	const u8 *mem = (const u8 *)psxCore.psxM; \
+	const u8 *old = (const u8 *)prevM; \
+	u32 w, k, n = 0; \
+\
+	for (w = 0; w < SEARCH_WORDS; w++) { \
+		const u8 *m = mem + w * 32, *o = old + w * 32; \
+		u32 bits = SearchBits[w] & searchAlign[width], keep = 0; \
+\
+		if (bits == 0) { \
+			SearchBits[w] = 0; \
+			continue; \
+		} \
+		for (k = 0; k < 32; k += width) { \
+			u32 cur = load(m, k), prev = load(o, k); \
+			keep |= (u32)(cond) << k; \
+			(void)prev; \
+		} \
+		SearchBits[w] = bits &= keep; \
+		n += __builtin_popcount(bits); \
+	} \
+	NumSearchResults = n; \
+} while (0)
+
+// Value searches also start a new search
+#define CHEAT_SEARCH_VALUE(width, load, cond) do { \
+	if (!CheatSearchStart(width)) return; \
+	CHEAT_SEARCH(width, load, cond); \
+} while (0)
+
+// Comparisons against the backup only narrow an existing search
+#define CHEAT_SEARCH_COMPARE(width, load, cond) do { \
+	assert(prevM != NULL); /* not possible for the first search */ \
+	if (SearchBits == NULL) return; \
+	CHEAT_SEARCH(width, load, cond); \
+} while (0)
 
-		for (i = 0; i < NumSearchResults; i++) {
-			if (PSXMu16(SearchResults[i]) == val) {
-				SearchResults[j++] = SearchResults[i];
-			}
-		}
+void CheatSearchEqual8(u8 val) {
+	CHEAT_SEARCH_VALUE(1, LOAD8, cur == val);
+}
 
-		NumSearchResults = j;
-	}
+void CheatSearchEqual16(u16 val) {
+	CHEAT_SEARCH_VALUE(2, LOAD16, cur == val);
 }
 
 void CheatSearchEqual32(u32 val) {
-	u32 i, j;
-
-	CheatSearchInitBackupMemory();
-
-	if (SearchResults == NULL) {
-		// search the whole memory
-		for (i = 0; i < 0x200000; i += 4) {
-			if (PSXMu32(i) == val) {
-				CheatSearchAddResult(i);
-			}
-		}
-	}
-	else {
-		// only search within the previous results
-		j = 0;
-
-		for (i = 0; i < NumSearchResults; i++) {
-			if (PSXMu32(SearchResults[i]) == val) {
-				SearchResults[j++] = SearchResults[i];
-			}
-		}
-
-		NumSearchResults = j;
-	}
+	CHEAT_SEARCH_VALUE(4, LOAD32, cur == val);
 }
 
 void CheatSearchNotEqual8(u8 val) {
-	u32 i, j;
-
-	CheatSearchInitBackupMemory();
-
-	if (SearchResults == NULL) {
-		// search the whole memory
-		for (i = 0; i < 0x200000; i++) {
-			if (PSXMu8(i) != val) {
-				CheatSearchAddResult(i);
-			}
-		}
-	}
-	else {
-		// only search within the previous results
-		j = 0;
-
-		for (i = 0; i < NumSearchResults; i++) {
-			if (PSXMu8(SearchResults[i]) != val) {
-				SearchResults[j++] = SearchResults[i];
-			}
-		}
-
-		NumSearchResults = j;
-	}
+	CHEAT_SEARCH_VALUE(1, LOAD8, cur != val);
 }
 
 void CheatSearchNotEqual16(u16 val) {
-	u32 i, j;
-
-	CheatSearchInitBackupMemory();
-
-	if (SearchResults == NULL) {
-		// search the whole memory
-		for (i = 0; i < 0x200000; i += 2) {
-			if (PSXMu16(i) != val) {
-				CheatSearchAddResult(i);
-			}
-		}
-	}
-	else {
-		// only search within the previous results
-		j = 0;
-
-		for (i = 0; i < NumSearchResults; i++) {
-			if (PSXMu16(SearchResults[i]) != val) {
-				SearchResults[j++] = SearchResults[i];
-			}
-		}
-
-		NumSearchResults = j;
-	}
+	CHEAT_SEARCH_VALUE(2, LOAD16, cur != val);
 }
 
 void CheatSearchNotEqual32(u32 val) {
-	u32 i, j;
-
-	CheatSearchInitBackupMemory();
-
-	if (SearchResults == NULL) {
-		// search the whole memory
-		for (i = 0; i < 0x200000; i += 4) {
-			if (PSXMu32(i) != val) {
-				CheatSearchAddResult(i);
-			}
-		}
-	}
-	else {
-		// only search within the previous results
-		j = 0;
-
-		for (i = 0; i < NumSearchResults; i++) {
-			if (PSXMu32(SearchResults[i]) != val) {
-				SearchResults[j++] = SearchResults[i];
-			}
-		}
-
-		NumSearchResults = j;
-	}
+	CHEAT_SEARCH_VALUE(4, LOAD32, cur != val);
 }
 
 void CheatSearchRange8(u8 min, u8 max) {
-	u32 i, j;
-
-	CheatSearchInitBackupMemory();
-
-	if (SearchResults == NULL) {
-		// search the whole memory
-		for (i = 0; i < 0x200000; i++) {
-			if (PSXMu8(i) >= min && PSXMu8(i) <= max) {
-				CheatSearchAddResult(i);
-			}
-		}
-	}
-	else {
-		// only search within the previous results
-		j = 0;
-
-		for (i = 0; i < NumSearchResults; i++) {
-			if (PSXMu8(SearchResults[i]) >= min && PSXMu8(SearchResults[i]) <= max) {
-				SearchResults[j++] = SearchResults[i];
-			}
-		}
-
-		NumSearchResults = j;
-	}
+	CHEAT_SEARCH_VALUE(1, LOAD8, (cur >= min) & (cur <= max));
 }
 
 void CheatSearchRange16(u16 min, u16 max) {
-	u32 i, j;
-
-	CheatSearchInitBackupMemory();
-
-	if (SearchResults == NULL) {
-		// search the whole memory
-		for (i = 0; i < 0x200000; i += 2) {
-			if (PSXMu16(i) >= min && PSXMu16(i) <= max) {
-				CheatSearchAddResult(i);
-			}
-		}
-	}
-	else {
-		// only search within the previous results
-		j = 0;
-
-		for (i = 0; i < NumSearchResults; i++) {
-			if (PSXMu16(SearchResults[i]) >= min && PSXMu16(SearchResults[i]) <= max) {
-				SearchResults[j++] = SearchResults[i];
-			}
-		}
-
-		NumSearchResults = j;
-	}
+	CHEAT_SEARCH_VALUE(2, LOAD16, (cur >= min) & (cur <= max));
 }
 
 void CheatSearchRange32(u32 min, u32 max) {
-	u32 i, j;
-
-	CheatSearchInitBackupMemory();
-
-	if (SearchResults == NULL) {
-		// search the whole memory
-		for (i = 0; i < 0x200000; i += 4) {
-			if (PSXMu32(i) >= min && PSXMu32(i) <= max) {
-				CheatSearchAddResult(i);
-			}
-		}
-	}
-	else {
-		// only search within the previous results
-		j = 0;
-
-		for (i = 0; i < NumSearchResults; i++) {
-			if (PSXMu32(SearchResults[i]) >= min && PSXMu32(SearchResults[i]) <= max) {
-				SearchResults[j++] = SearchResults[i];
-			}
-		}
-
-		NumSearchResults = j;
-	}
+	CHEAT_SEARCH_VALUE(4, LOAD32, (cur >= min) & (cur <= max));
 }
 
 void CheatSearchIncreasedBy8(u8 val) {
-	u32 i, j;
-
-	assert(prevM != NULL); // not possible for the first search
-
-	j = 0;
-
-	for (i = 0; i < NumSearchResults; i++) {
-		if (PSXMu8(SearchResults[i]) - PrevMu8(SearchResults[i]) == val) {
-			SearchResults[j++] = SearchResults[i];
-		}
-	}
-
-	NumSearchResults = j;
+	CHEAT_SEARCH_COMPARE(1, LOAD8, cur - prev == val);
 }
 
 void CheatSearchIncreasedBy16(u16 val) {
-	u32 i, j;
-
-	assert(prevM != NULL); // not possible for the first search
-
-	j = 0;
-
-	for (i = 0; i < NumSearchResults; i++) {
-		if (PSXMu16(SearchResults[i]) - PrevMu16(SearchResults[i]) == val) {
-			SearchResults[j++] = SearchResults[i];
-		}
-	}
-
-	NumSearchResults = j;
+	CHEAT_SEARCH_COMPARE(2, LOAD16, cur - prev == val);
 }
 
 void CheatSearchIncreasedBy32(u32 val) {
-	u32 i, j;
-
-	assert(prevM != NULL); // not possible for the first search
-
-	j = 0;
-
-	for (i = 0; i < NumSearchResults; i++) {
-		if (PSXMu32(SearchResults[i]) - PrevMu32(SearchResults[i]) == val) {
-			SearchResults[j++] = SearchResults[i];
-		}
-	}
-
-	NumSearchResults = j;
+	CHEAT_SEARCH_COMPARE(4, LOAD32, cur - prev == val);
 }
 
 void CheatSearchDecreasedBy8(u8 val) {
-	u32 i, j;
-
-	assert(prevM != NULL); // not possible for the first search
-
-	j = 0;
-
-	for (i = 0; i < NumSearchResults; i++) {
-		if (PrevMu8(SearchResults[i]) - PSXMu8(SearchResults[i]) == val) {
-			SearchResults[j++] = SearchResults[i];
-		}
-	}
-
-	NumSearchResults = j;
+	CHEAT_SEARCH_COMPARE(1, LOAD8, prev - cur == val);
 }
 
 void CheatSearchDecreasedBy16(u16 val) {
-	u32 i, j;
-
-	assert(prevM != NULL); // not possible for the first search
-
-	j = 0;
-
-	for (i = 0; i < NumSearchResults; i++) {
-		if (PrevMu16(SearchResults[i]) - PSXMu16(SearchResults[i]) == val) {
-			SearchResults[j++] = SearchResults[i];
-		}
-	}
-
-	NumSearchResults = j;
+	CHEAT_SEARCH_COMPARE(2, LOAD16, prev - cur == val);
 }
 
 void CheatSearchDecreasedBy32(u32 val) {
-	u32 i, j;
-
-	assert(prevM != NULL); // not possible for the first search
-
-	j = 0;
-
-	for (i = 0; i < NumSearchResults; i++) {
-		if (PrevMu32(SearchResults[i]) - PSXMu32(SearchResults[i]) == val) {
-			SearchResults[j++] = SearchResults[i];
-		}
-	}
-
-	NumSearchResults = j;
+	CHEAT_SEARCH_COMPARE(4, LOAD32, prev - cur == val);
 }
 
 void CheatSearchIncreased8() {
-	u32 i, j;
-
-	assert(prevM != NULL); // not possible for the first search
-
-	j = 0;
-
-	for (i = 0; i < NumSearchResults; i++) {
-		if (PrevMu8(SearchResults[i]) < PSXMu8(SearchResults[i])) {
-			SearchResults[j++] = SearchResults[i];
-		}
-	}
-
-	NumSearchResults = j;
+	CHEAT_SEARCH_COMPARE(1, LOAD8, prev < cur);
 }
 
 void CheatSearchIncreased16() {
-	u32 i, j;
-
-	assert(prevM != NULL); // not possible for the first search
-
-	j = 0;
-
-	for (i = 0; i < NumSearchResults; i++) {
-		if (PrevMu16(SearchResults[i]) < PSXMu16(SearchResults[i])) {
-			SearchResults[j++] = SearchResults[i];
-		}
-	}
-
-	NumSearchResults = j;
+	CHEAT_SEARCH_COMPARE(2, LOAD16, prev < cur);
 }
 
 void CheatSearchIncreased32() {
-	u32 i, j;
-
-	assert(prevM != NULL); // not possible for the first search
-
-	j = 0;
-
-	for (i = 0; i < NumSearchResults; i++) {
-		if (PrevMu32(SearchResults[i]) < PSXMu32(SearchResults[i])) {
-			SearchResults[j++] = SearchResults[i];
-		}
-	}
-
-	NumSearchResults = j;
+	CHEAT_SEARCH_COMPARE(4, LOAD32, prev < cur);
 }
 
 void CheatSearchDecreased8() {
-	u32 i, j;
-
-	assert(prevM != NULL); // not possible for the first search
-
-	j = 0;
-
-	for (i = 0; i < NumSearchResults; i++) {
-		if (PrevMu8(SearchResults[i]) > PSXMu8(SearchResults[i])) {
-			SearchResults[j++] = SearchResults[i];
-		}
-	}
-
-	NumSearchResults = j;
+	CHEAT_SEARCH_COMPARE(1, LOAD8, prev > cur);
 }
 
 void CheatSearchDecreased16() {
-	u32 i, j;
-
-	assert(prevM != NULL); // not possible for the first search
-
-	j = 0;
-
-	for (i = 0; i < NumSearchResults; i++) {
-		if (PrevMu16(SearchResults[i]) > PSXMu16(SearchResults[i])) {
-			SearchResults[j++] = SearchResults[i];
-		}
-	}
-
-	NumSearchResults = j;
+	CHEAT_SEARCH_COMPARE(2, LOAD16, prev > cur);
 }
 
 void CheatSearchDecreased32() {
-	u32 i, j;
-
-	assert(prevM != NULL); // not possible for the first search
-
-	j = 0;
-
-	for (i = 0; i < NumSearchResults; i++) {
-		if (PrevMu32(SearchResults[i]) > PSXMu32(SearchResults[i])) {
-			SearchResults[j++] = SearchResults[i];
-		}
-	}
-
-	NumSearchResults = j;
+	CHEAT_SEARCH_COMPARE(4, LOAD32, prev > cur);
 }
 
 void CheatSearchDifferent8() {
-	u32 i, j;
-
-	assert(prevM != NULL); // not possible for the first search
-
-	j = 0;
-
-	for (i = 0; i < NumSearchResults; i++) {
-		if (PrevMu8(SearchResults[i]) != PSXMu8(SearchResults[i])) {
-			SearchResults[j++] = SearchResults[i];
-		}
-	}
-
-	NumSearchResults = j;
+	CHEAT_SEARCH_COMPARE(1, LOAD8, prev != cur);
 }
 
 void CheatSearchDifferent16() {
-	u32 i, j;
-
-	assert(prevM != NULL); // not possible for the first search
-
-	j = 0;
-
-	for (i = 0; i < NumSearchResults; i++) {
-		if (PrevMu16(SearchResults[i]) != PSXMu16(SearchResults[i])) {
-			SearchResults[j++] = SearchResults[i];
-		}
-	}
-
-	NumSearchResults = j;
+	CHEAT_SEARCH_COMPARE(2, LOAD16, prev != cur);
 }
 
 void CheatSearchDifferent32() {
-	u32 i, j;
-
-	assert(prevM != NULL); // not possible for the first search
-
-	j = 0;
-
-	for (i = 0; i < NumSearchResults; i++) {
-		if (PrevMu32(SearchResults[i]) != PSXMu32(SearchResults[i])) {
-			SearchResults[j++] = SearchResults[i];
-		}
-	}
-
-	NumSearchResults = j;
+	CHEAT_SEARCH_COMPARE(4, LOAD32, prev != cur);
 }
 
 void CheatSearchNoChange8() {
-	u32 i, j;
-
-	assert(prevM != NULL); // not possible for the first search
-
-	j = 0;
-
-	for (i = 0; i < NumSearchResults; i++) {
-		if (PrevMu8(SearchResults[i]) == PSXMu8(SearchResults[i])) {
-			SearchResults[j++] = SearchResults[i];
-		}
-	}
-
-	NumSearchResults = j;
+	CHEAT_SEARCH_COMPARE(1, LOAD8, prev == cur);
 }
 
 void CheatSearchNoChange16() {
-	u32 i, j;
-
-	assert(prevM != NULL); // not possible for the first search
-
-	j = 0;
-
-	for (i = 0; i < NumSearchResults; i++) {
-		if (PrevMu16(SearchResults[i]) == PSXMu16(SearchResults[i])) {
-			SearchResults[j++] = SearchResults[i];
-		}
-	}
-
-	NumSearchResults = j;
+	CHEAT_SEARCH_COMPARE(2, LOAD16, prev == cur);
 }
 
 void CheatSearchNoChange32() {
-	u32 i, j;
-
-	assert(prevM != NULL); // not possible for the first search
-
-	j = 0;
-
-	for (i = 0; i < NumSearchResults; i++) {
-		if (PrevMu32(SearchResults[i]) == PSXMu32(SearchResults[i])) {
-			SearchResults[j++] = SearchResults[i];
-		}
-	}
-
-	NumSearchResults = j;
+	CHEAT_SEARCH_COMPARE(4, LOAD32, prev == cur);
 }
+
@@ -32,7 +32,7 @@ typedef struct {
 	char		*Descr;
 	int			First;		// index of the first cheat code
 	int			n;			// number of cheat codes for this cheat
-	int			Enabled;
+	int			Enabled;	// set through EnableCheat() so ApplyCheats sees it
 } Cheat;
 
 void ClearAllCheats();
@@ -44,11 +44,13 @@ void ApplyCheats();
 
 int AddCheat(const char *descr, char *code);
 void RemoveCheat(int index);
+void EnableCheat(int index, int enabled);
 int EditCheat(int index, const char *descr, char *code);
 
 void FreeCheatSearchResults();
 void FreeCheatSearchMem();
 void CheatSearchBackupMemory();
+int CheatSearchGetResults(u32 *addrs, int first, int count);
 
 void CheatSearchEqual8(u8 val);
 void CheatSearchEqual16(u16 val);
@@ -84,7 +86,6 @@ extern int NumCheats;
 extern int NumCodes;
 
 extern s8 *prevM;
-extern u32 *SearchResults;
 extern int NumSearchResults;
 
 #define PREVM(mem)		(&prevM[mem])
@@ -14,6 +14,8 @@
 #include "externals.h"*/
 #include "franspu.h"
 #include "../PsxCommon.h"
+#include "../SpuTrace.h"
+#include "spu_ring.h"
 
 ////////////////////////////////////////////////////////////////////////
 // cube audio globals
@@ -28,9 +30,8 @@ static const u32 freq = 44100;
 extern unsigned int iVolume; 
 static AESNDPB* voice = NULL;
 
-#define NUM_BUFFERS 4
-static struct { void* buffer; u32 len; } buffers[NUM_BUFFERS];
-static u32 fill_buffer, play_buffer;
+// The mixer feeds spu_ring.c and the voice callback plays out of it
+static u32 cur_freq;
 
 static void aesnd_callback(AESNDPB* voice, u32 state);
 
@@ -47,12 +48,14 @@ void SetVolume(void)
 
 void SetupSound(void)
 {
+	RingReset();
+	cur_freq = freq;
+
 	voice = AESND_AllocateVoice(aesnd_callback);
 	AESND_SetVoiceFormat(voice, iDisStereo ? VOICE_MONO16 : VOICE_STEREO16);
 	AESND_SetVoiceFrequency(voice, freq);
 	SetVolume();
 	AESND_SetVoiceStream(voice, true);
-	fill_buffer = play_buffer = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -70,24 +73,16 @@ void RemoveSound(void)
 
 unsigned long SoundGetBytesBuffered(void)
 {
-	unsigned long bytes_buffered = 0, i = fill_buffer;
-	while(1) {
-		bytes_buffered += buffers[i].len;
-		
-		if(i == play_buffer) break;
-		i = (i + NUM_BUFFERS - 1) % NUM_BUFFERS;
-	}
-	
-	return bytes_buffered;
+	return RingFill();
 }
 
 static void aesnd_callback(AESNDPB* voice, u32 state){
 	if(state == VOICE_STATE_STREAM) {
-		if(play_buffer != fill_buffer) {
-			AESND_SetVoiceBuffer(voice,
-					buffers[play_buffer].buffer, buffers[play_buffer].len);
-			play_buffer = (play_buffer + 1) % NUM_BUFFERS;
-		}
+		u8 *chunk;
+		u32 len = RingPlay(&chunk);
+
+		if(len)
+			AESND_SetVoiceBuffer(voice, chunk, len);
 	}
 }
 
@@ -96,12 +91,25 @@ static void aesnd_callback(AESNDPB* voice, u32 state){
 ////////////////////////////////////////////////////////////////////////
 void SoundFeedStreamData(unsigned char* pSound,long lBytes)
 {
+	u32 new_freq;
+
+	// an SPU trace replay collects the output instead of playing it
+	if(SpuTraceSink) {
+		SpuTraceSink(pSound, lBytes);
+		return;
+	}
+
 	if(!audioEnabled) return;
-	
-	buffers[fill_buffer].buffer = pSound;
-	buffers[fill_buffer].len = lBytes;
-	fill_buffer = (fill_buffer + 1) % NUM_BUFFERS;
-	
+
+	// what does not fit is dropped
+	if(lBytes <= 0 || RingWrite(pSound, lBytes) == 0) return;
+
+	new_freq = RingRate(freq);
+	if(new_freq != cur_freq) {
+		cur_freq = new_freq;
+		AESND_SetVoiceFrequency(voice, cur_freq);
+	}
+
 	AESND_SetVoiceStop(voice, false);
 }
 
@@ -0,0 +1,104 @@
+//spu_ring.c Audio ring between the mixer and the output backend
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version. See also the license.txt file for *
+ *   additional informations.                                              *
+ *                                                                         *
+ ***************************************************************************/
+
+#include <gccore.h>
+#include "spu_ring.h"
+
+// The mixer copies each block into a single-producer/single-consumer ring
+// and the output plays straight out of it. On the console the consumer is
+// the audio interrupt on the same core, so the two indices only need to be
+// ordered against the compiler; each side writes exactly one of them.
+static u8 ring[RING_SIZE] __attribute__((aligned(32)));
+static volatile u32 ring_head;			// bytes produced, written by the producer only
+static volatile u32 ring_tail;			// bytes released, written by the consumer only
+static volatile u32 play_len;			// bytes of the chunk being played
+
+#define ring_barrier()	__asm__ __volatile__("" ::: "memory")
+
+void RingReset(void)
+{
+	ring_head = ring_tail = play_len = 0;
+}
+
+u32 RingFill(void)
+{
+	return ring_head - ring_tail;
+}
+
+////////////////////////////////////////////////////////////////////////
+// PRODUCER
+////////////////////////////////////////////////////////////////////////
+
+// Copies in as much of src as fits and returns how much that was; the
+// rest is dropped
+u32 RingWrite(const u8 *src, u32 len)
+{
+	u32 head = ring_head, space, first;
+
+	space = RING_SIZE - (head - ring_tail);
+	if(len > space) len = space;
+	if(len == 0) return 0;
+
+	first = RING_SIZE - (head & RING_MASK);
+	if(first > len) first = len;
+	memcpy(ring + (head & RING_MASK), src, first);
+	DCFlushRange(ring + (head & RING_MASK), first);
+	if(first < len) {
+		memcpy(ring, src + first, len - first);
+		DCFlushRange(ring, len - first);
+	}
+
+	ring_barrier();
+	ring_head = head + len;
+	return len;
+}
+
+////////////////////////////////////////////////////////////////////////
+// CONSUMER
+////////////////////////////////////////////////////////////////////////
+
+// Called once the previous chunk has been played: hands its space back and
+// returns the next one, 32-byte aligned and never wrapping, or 0 if there
+// is nothing to play
+u32 RingPlay(u8 **chunk)
+{
+	u32 tail, len;
+
+	tail = ring_tail + play_len;
+	ring_barrier();
+	ring_tail = tail;
+
+	len = (ring_head - tail) & ~31;
+	if(len > RING_CHUNK) len = RING_CHUNK;
+	if(len > RING_SIZE - (tail & RING_MASK)) len = RING_SIZE - (tail & RING_MASK);
+
+	play_len = len;
+	*chunk = ring + (tail & RING_MASK);
+	return len;
+}
+
+////////////////////////////////////////////////////////////////////////
+// RATE CONTROL
+////////////////////////////////////////////////////////////////////////
+
+// The rate to play at so the fill level settles around RING_TARGET: up to
+// 0.5% faster while the mixer runs ahead and as much slower while it lags,
+// instead of letting the ring overflow or underrun.
+u32 RingRate(u32 freq)
+{
+	s32 range = freq / 200;
+	s32 delta = ((s32)RingFill() - RING_TARGET) * range / RING_TARGET;
+
+	if(delta > range) delta = range;
+	if(delta < -range) delta = -range;
+	return freq + delta;
+}
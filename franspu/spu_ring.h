@@ -0,0 +1,29 @@
+//spu_ring.h Audio ring between the mixer and the output backend
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version. See also the license.txt file for *
+ *   additional informations.                                              *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef __SPU_RING_H__
+#define __SPU_RING_H__
+
+#include "../PsxCommon.h"
+
+#define RING_SIZE		(32 * 1024)		// must be a power of two
+#define RING_MASK		(RING_SIZE - 1)
+#define RING_CHUNK		2048			// most bytes handed to the DSP at once
+#define RING_TARGET		(6 * 1024)		// fill level the rate control aims for
+
+void RingReset(void);
+u32 RingFill(void);
+u32 RingWrite(const u8 *src, u32 len);
+u32 RingPlay(u8 **chunk);
+u32 RingRate(u32 freq);
+
+#endif
@@ -21,6 +21,11 @@
 
 /*
 * GTE functions.
+*
+* gte_nf.c builds the command ops a second time with FLAGLESS defined:
+* the _nf variants compute the same results but skip all of the FLAG
+* bookkeeping, for when the recompiler can tell FLAG is overwritten
+* before anything reads it.
 */
 
 #include "gte.h"
@@ -168,11 +173,17 @@
 
 #define gteop (psxCore.code & 0x1ffffff)
 
+#ifdef FLAGLESS
+#define gteSetFlag(f)
+#else
+#define gteSetFlag(f)	gteFLAG |= (f)
+#endif
+
 static inline s64 BOUNDS(s64 n_value, s64 n_max, int n_maxflag, s64 n_min, int n_minflag) {
 	if (n_value > n_max) {
-		gteFLAG |= n_maxflag;
+		gteSetFlag(n_maxflag);
 	} else if (n_value < n_min) {
-		gteFLAG |= n_minflag;
+		gteSetFlag(n_minflag);
 	}
 	return n_value;
 }
@@ -180,10 +191,10 @@ static inline s64 BOUNDS(s64 n_value, s64 n_max, int n_maxflag, s64 n_min, int n
 static inline s32 LIM(s32 value, s32 max, s32 min, u32 flag) {
 	s32 ret = value;
 	if (value > max) {
-		gteFLAG |= flag;
+		gteSetFlag(flag);
 		ret = max;
 	} else if (value < min) {
-		gteFLAG |= flag;
+		gteSetFlag(flag);
 		ret = min;
 	}
 	return ret;
@@ -202,7 +213,7 @@ static inline s32 LIM(s32 value, s32 max, s32 min, u32 flag) {
 
 static inline u32 limE(u32 result) {
 	if (result > 0x1ffff) {
-		gteFLAG |= (1 << 31) | (1 << 17);
+		gteSetFlag((1 << 31) | (1 << 17));
 		return 0x1ffff;
 	}
 	return result;
@@ -215,6 +226,7 @@ static inline u32 limE(u32 result) {
 
 #include "gte_divider.h"
 
+#ifndef FLAGLESS
 static inline u32 MFC2(int reg) {
 	switch (reg) {
 		case 1:
@@ -368,6 +380,139 @@ void gteLWC2() {
 void gteSWC2() {
 	psxMemWrite32(_oB_, MFC2(_Rt_));
 }
+#endif
+
+/* Three-lane kernels for the vertex and lighting ops.
+ * A stage computes the three rows (MAC1-3 / IR1-3) side by side from
+ * matrices loaded once per op, then derives the saturation flags of all
+ * lanes with one range test; only lanes that are out of range go through
+ * the per-component checks. FLAG is only ORed into, so the order the lanes
+ * raise their bits in does not matter and the result is bit-exact with
+ * the A1-A3 / limB1-3 / limC1-3 macros.
+ */
+typedef struct {
+	s32 m[3][3];
+} gteMatrix;
+
+static const u32 gteFlagAmax[3] = { (1 << 30), (1 << 29), (1 << 28) };
+static const u32 gteFlagAmin[3] = { (1 << 31) | (1 << 27), (1 << 31) | (1 << 26), (1 << 31) | (1 << 25) };
+static const u32 gteFlagB[3] = { (1 << 31) | (1 << 24), (1 << 31) | (1 << 23), (1 << 22) };
+static const u32 gteFlagC[3] = { (1 << 21), (1 << 20), (1 << 19) };
+
+// n: 0 rotation, 1 light, 2 light colour, 3 reads as zero
+static inline void gteLoadMatrix(gteMatrix *mx, int n) {
+	mx->m[0][0] = MX11(n); mx->m[0][1] = MX12(n); mx->m[0][2] = MX13(n);
+	mx->m[1][0] = MX21(n); mx->m[1][1] = MX22(n); mx->m[1][2] = MX23(n);
+	mx->m[2][0] = MX31(n); mx->m[2][1] = MX32(n); mx->m[2][2] = MX33(n);
+}
+
+// mac = A1..A3(sum)
+static inline void gteLimA3(s32 *mac, const s64 *sum) {
+	int i;
+
+	mac[0] = (s32)sum[0];
+	mac[1] = (s32)sum[1];
+	mac[2] = (s32)sum[2];
+
+	// a lane overflowed when it does not survive the truncation
+	if ((sum[0] != mac[0]) | (sum[1] != mac[1]) | (sum[2] != mac[2])) {
+		for (i = 0; i < 3; i++) {
+			if (sum[i] > 0x7fffffff) gteSetFlag(gteFlagAmax[i]);
+			else if (sum[i] < -(s64)0x80000000) gteSetFlag(gteFlagAmin[i]);
+		}
+	}
+}
+
+// mac = A1..A3(((t << 12) + mx * v) >> shift)
+static inline void gteTransform(s32 *mac, const gteMatrix *mx, const s32 *t,
+								s32 vx, s32 vy, s32 vz, int shift) {
+	s64 sum[3];
+	int i;
+
+	if (shift == 12) {
+		// Stay in 32 bits: each product is split at bit 12 so that
+		// (t << 12 + p0 + p1 + p2) >> 12 == t + hi + (lo >> 12), and only
+		// the final add with t can overflow.
+		u32 over = 0;
+
+		for (i = 0; i < 3; i++) {
+			s32 p0 = mx->m[i][0] * vx;
+			s32 p1 = mx->m[i][1] * vy;
+			s32 p2 = mx->m[i][2] * vz;
+			s32 hi = (p0 >> 12) + (p1 >> 12) + (p2 >> 12);
+			s32 lo = (p0 & 0xfff) + (p1 & 0xfff) + (p2 & 0xfff);
+			s32 part = hi + (lo >> 12);
+
+			mac[i] = (s32)((u32)t[i] + (u32)part);
+			over |= (t[i] ^ mac[i]) & (part ^ mac[i]);
+		}
+		if (!(over & 0x80000000))
+			return;
+		// a lane overflowed: redo it in 64 bits for the flags
+	}
+
+	for (i = 0; i < 3; i++)
+		sum[i] = (((s64)t[i] << 12) + (mx->m[i][0] * vx) + (mx->m[i][1] * vy) + (mx->m[i][2] * vz)) >> shift;
+	gteLimA3(mac, sum);
+}
+
+// ir = limB1..limB3(mac, lm)
+static inline void gteLimB3(s32 *ir, const s32 *mac, int lm) {
+	u32 min = lm ? 0 : (u32)-0x8000;
+	u32 range = 0x7fff - min;
+	int i;
+
+	ir[0] = mac[0];
+	ir[1] = mac[1];
+	ir[2] = mac[2];
+
+	if (((u32)mac[0] - min > range) | ((u32)mac[1] - min > range) | ((u32)mac[2] - min > range)) {
+		for (i = 0; i < 3; i++) {
+			if ((u32)mac[i] - min > range) {
+				gteSetFlag(gteFlagB[i]);
+				ir[i] = (mac[i] > 0x7fff) ? 0x7fff : (s32)min;
+			}
+		}
+	}
+}
+
+// push limC1..limC3(mac >> 4) on the colour FIFO
+static inline void gtePushColour(const s32 *mac) {
+	s32 c[3];
+	int i;
+
+	c[0] = mac[0] >> 4;
+	c[1] = mac[1] >> 4;
+	c[2] = mac[2] >> 4;
+
+	if (((u32)c[0] > 0xff) | ((u32)c[1] > 0xff) | ((u32)c[2] > 0xff)) {
+		for (i = 0; i < 3; i++) {
+			if ((u32)c[i] > 0xff) {
+				gteSetFlag(gteFlagC[i]);
+				c[i] = (c[i] > 0xff) ? 0xff : 0;
+			}
+		}
+	}
+
+	gteRGB0 = gteRGB1;
+	gteRGB1 = gteRGB2;
+	gteCODE2 = gteCODE;
+	gteR2 = c[0];
+	gteG2 = c[1];
+	gteB2 = c[2];
+}
+
+static inline void gteStoreMAC(const s32 *mac) {
+	gteMAC1 = mac[0];
+	gteMAC2 = mac[1];
+	gteMAC3 = mac[2];
+}
+
+static inline void gteStoreIR(const s32 *ir) {
+	gteIR1 = ir[0];
+	gteIR2 = ir[1];
+	gteIR3 = ir[2];
+}
 
 void gteRTPS() {
 	int quotient;
@@ -398,31 +543,37 @@ void gteRTPS() {
 }
 
 void gteRTPT() {
+	gteMatrix rt;
+	s32 tr[3], mac[3][3], ir[3][3];
 	int quotient;
 	int v;
-	s32 vx, vy, vz;
 
 #ifdef GTE_LOG
 	GTE_LOG("GTE RTPT\n");
 #endif
 	gteFLAG = 0;
 
+	gteLoadMatrix(&rt, 0);
+	tr[0] = gteTRX;
+	tr[1] = gteTRY;
+	tr[2] = gteTRZ;
+
+	// transform the three vertices, then project them
+	for (v = 0; v < 3; v++) {
+		gteTransform(mac[v], &rt, tr, VX(v), VY(v), VZ(v), 12);
+		gteLimB3(ir[v], mac[v], 0);
+	}
+
 	gteSZ0 = gteSZ3;
 	for (v = 0; v < 3; v++) {
-		vx = VX(v);
-		vy = VY(v);
-		vz = VZ(v);
-		gteMAC1 = A1((((s64)gteTRX << 12) + (gteR11 * vx) + (gteR12 * vy) + (gteR13 * vz)) >> 12);
-		gteMAC2 = A2((((s64)gteTRY << 12) + (gteR21 * vx) + (gteR22 * vy) + (gteR23 * vz)) >> 12);
-		gteMAC3 = A3((((s64)gteTRZ << 12) + (gteR31 * vx) + (gteR32 * vy) + (gteR33 * vz)) >> 12);
-		gteIR1 = limB1(gteMAC1, 0);
-		gteIR2 = limB2(gteMAC2, 0);
-		gteIR3 = limB3(gteMAC3, 0);
-		fSZ(v) = limD(gteMAC3);
+		fSZ(v) = limD(mac[v][2]);
 		quotient = limE(DIVIDE(gteH, fSZ(v)));
-		fSX(v) = limG1(F((s64)gteOFX + ((s64)gteIR1 * quotient)) >> 16);
-		fSY(v) = limG2(F((s64)gteOFY + ((s64)gteIR2 * quotient)) >> 16);
+		fSX(v) = limG1(F((s64)gteOFX + ((s64)ir[v][0] * quotient)) >> 16);
+		fSY(v) = limG2(F((s64)gteOFY + ((s64)ir[v][1] * quotient)) >> 16);
 	}
+	gteStoreMAC(mac[2]);
+	gteStoreIR(ir[2]);
+
 	gteMAC0 = F((s64)(gteDQB + ((s64)gteDQA * quotient)) >> 12);
 	gteIR0 = limH(gteMAC0);
 }
@@ -433,22 +584,23 @@ void gteMVMVA() {
 	int v = GTE_V(gteop);
 	int cv = GTE_CV(gteop);
 	int lm = GTE_LM(gteop);
-	s32 vx = VX(v);
-	s32 vy = VY(v);
-	s32 vz = VZ(v);
+	gteMatrix m;
+	s32 t[3], mac[3], ir[3];
 
 #ifdef GTE_LOG
 	GTE_LOG("GTE MVMVA\n");
 #endif
 	gteFLAG = 0;
 
-	gteMAC1 = A1((((s64)CV1(cv) << 12) + (MX11(mx) * vx) + (MX12(mx) * vy) + (MX13(mx) * vz)) >> shift);
-	gteMAC2 = A2((((s64)CV2(cv) << 12) + (MX21(mx) * vx) + (MX22(mx) * vy) + (MX23(mx) * vz)) >> shift);
-	gteMAC3 = A3((((s64)CV3(cv) << 12) + (MX31(mx) * vx) + (MX32(mx) * vy) + (MX33(mx) * vz)) >> shift);
+	gteLoadMatrix(&m, mx);
+	t[0] = CV1(cv);
+	t[1] = CV2(cv);
+	t[2] = CV3(cv);
 
-	gteIR1 = limB1(gteMAC1, lm);
-	gteIR2 = limB2(gteMAC2, lm);
-	gteIR3 = limB3(gteMAC3, lm);
+	gteTransform(mac, &m, t, VX(v), VY(v), VZ(v), shift);
+	gteLimB3(ir, mac, lm);
+	gteStoreMAC(mac);
+	gteStoreIR(ir);
 }
 
 void gteNCLIP() {
@@ -533,44 +685,38 @@ void gteNCCS() {
 }
 
 void gteNCCT() {
-	int v;
-	s32 vx, vy, vz;
+	static const s32 zero[3] = { 0, 0, 0 };
+	gteMatrix llm, lcm;
+	s32 bk[3], rgb[3], mac[3], ir[3];
+	int v, i;
 
 #ifdef GTE_LOG
 	GTE_LOG("GTE NCCT\n");
 #endif
 	gteFLAG = 0;
 
-	for (v = 0; v < 3; v++) {
-		vx = VX(v);
-		vy = VY(v);
-		vz = VZ(v);
-		gteMAC1 = A1((((s64)gteL11 * vx) + (gteL12 * vy) + (gteL13 * vz)) >> 12);
-		gteMAC2 = A2((((s64)gteL21 * vx) + (gteL22 * vy) + (gteL23 * vz)) >> 12);
-		gteMAC3 = A3((((s64)gteL31 * vx) + (gteL32 * vy) + (gteL33 * vz)) >> 12);
-		gteIR1 = limB1(gteMAC1, 1);
-		gteIR2 = limB2(gteMAC2, 1);
-		gteIR3 = limB3(gteMAC3, 1);
-		gteMAC1 = A1((((s64)gteRBK << 12) + (gteLR1 * gteIR1) + (gteLR2 * gteIR2) + (gteLR3 * gteIR3)) >> 12);
-		gteMAC2 = A2((((s64)gteGBK << 12) + (gteLG1 * gteIR1) + (gteLG2 * gteIR2) + (gteLG3 * gteIR3)) >> 12);
-		gteMAC3 = A3((((s64)gteBBK << 12) + (gteLB1 * gteIR1) + (gteLB2 * gteIR2) + (gteLB3 * gteIR3)) >> 12);
-		gteIR1 = limB1(gteMAC1, 1);
-		gteIR2 = limB2(gteMAC2, 1);
-		gteIR3 = limB3(gteMAC3, 1);
-		gteMAC1 = A1(((s64)gteR * gteIR1) >> 8);
-		gteMAC2 = A2(((s64)gteG * gteIR2) >> 8);
-		gteMAC3 = A3(((s64)gteB * gteIR3) >> 8);
+	gteLoadMatrix(&llm, 1);
+	gteLoadMatrix(&lcm, 2);
+	bk[0] = gteRBK;
+	bk[1] = gteGBK;
+	bk[2] = gteBBK;
+	rgb[0] = gteR;
+	rgb[1] = gteG;
+	rgb[2] = gteB;
 
-		gteRGB0 = gteRGB1;
-		gteRGB1 = gteRGB2;
-		gteCODE2 = gteCODE;
-		gteR2 = limC1(gteMAC1 >> 4);
-		gteG2 = limC2(gteMAC2 >> 4);
-		gteB2 = limC3(gteMAC3 >> 4);
+	for (v = 0; v < 3; v++) {
+		gteTransform(mac, &llm, zero, VX(v), VY(v), VZ(v), 12);
+		gteLimB3(ir, mac, 1);
+		gteTransform(mac, &lcm, bk, ir[0], ir[1], ir[2], 12);
+		gteLimB3(ir, mac, 1);
+		// colour * light, R/G/B < 256 so this cannot overflow
+		for (i = 0; i < 3; i++)
+			mac[i] = (rgb[i] * ir[i]) >> 8;
+		gtePushColour(mac);
 	}
-	gteIR1 = limB1(gteMAC1, 1);
-	gteIR2 = limB2(gteMAC2, 1);
-	gteIR3 = limB3(gteMAC3, 1);
+	gteStoreMAC(mac);
+	gteLimB3(ir, mac, 1);
+	gteStoreIR(ir);
 }
 
 void gteNCDS() {
@@ -607,44 +753,46 @@ void gteNCDS() {
 }
 
 void gteNCDT() {
-	int v;
-	s32 vx, vy, vz;
+	static const s32 zero[3] = { 0, 0, 0 };
+	gteMatrix llm, lcm;
+	s32 bk[3], rgb[3], mac[3], ir[3];
+	s32 fc[3], d[3];
+	int v, i;
 
 #ifdef GTE_LOG
 	GTE_LOG("GTE NCDT\n");
 #endif
 	gteFLAG = 0;
 
-	for (v = 0; v < 3; v++) {
-		vx = VX(v);
-		vy = VY(v);
-		vz = VZ(v);
-		gteMAC1 = A1((((s64)gteL11 * vx) + (gteL12 * vy) + (gteL13 * vz)) >> 12);
-		gteMAC2 = A2((((s64)gteL21 * vx) + (gteL22 * vy) + (gteL23 * vz)) >> 12);
-		gteMAC3 = A3((((s64)gteL31 * vx) + (gteL32 * vy) + (gteL33 * vz)) >> 12);
-		gteIR1 = limB1(gteMAC1, 1);
-		gteIR2 = limB2(gteMAC2, 1);
-		gteIR3 = limB3(gteMAC3, 1);
-		gteMAC1 = A1((((s64)gteRBK << 12) + (gteLR1 * gteIR1) + (gteLR2 * gteIR2) + (gteLR3 * gteIR3)) >> 12);
-		gteMAC2 = A2((((s64)gteGBK << 12) + (gteLG1 * gteIR1) + (gteLG2 * gteIR2) + (gteLG3 * gteIR3)) >> 12);
-		gteMAC3 = A3((((s64)gteBBK << 12) + (gteLB1 * gteIR1) + (gteLB2 * gteIR2) + (gteLB3 * gteIR3)) >> 12);
-		gteIR1 = limB1(gteMAC1, 1);
-		gteIR2 = limB2(gteMAC2, 1);
-		gteIR3 = limB3(gteMAC3, 1);
-		gteMAC1 = A1(((((s64)gteR << 4) * gteIR1) + (gteIR0 * limB1(gteRFC - ((gteR * gteIR1) >> 8), 0))) >> 12);
-		gteMAC2 = A2(((((s64)gteG << 4) * gteIR2) + (gteIR0 * limB2(gteGFC - ((gteG * gteIR2) >> 8), 0))) >> 12);
-		gteMAC3 = A3(((((s64)gteB << 4) * gteIR3) + (gteIR0 * limB3(gteBFC - ((gteB * gteIR3) >> 8), 0))) >> 12);
+	gteLoadMatrix(&llm, 1);
+	gteLoadMatrix(&lcm, 2);
+	bk[0] = gteRBK;
+	bk[1] = gteGBK;
+	bk[2] = gteBBK;
+	rgb[0] = gteR;
+	rgb[1] = gteG;
+	rgb[2] = gteB;
+	fc[0] = gteRFC;
+	fc[1] = gteGFC;
+	fc[2] = gteBFC;
 
-		gteRGB0 = gteRGB1;
-		gteRGB1 = gteRGB2;
-		gteCODE2 = gteCODE;
-		gteR2 = limC1(gteMAC1 >> 4);
-		gteG2 = limC2(gteMAC2 >> 4);
-		gteB2 = limC3(gteMAC3 >> 4);
+	for (v = 0; v < 3; v++) {
+		gteTransform(mac, &llm, zero, VX(v), VY(v), VZ(v), 12);
+		gteLimB3(ir, mac, 1);
+		gteTransform(mac, &lcm, bk, ir[0], ir[1], ir[2], 12);
+		gteLimB3(ir, mac, 1);
+		// depth cue towards the far colour
+		for (i = 0; i < 3; i++)
+			d[i] = fc[i] - ((rgb[i] * ir[i]) >> 8);
+		gteLimB3(d, d, 0);
+		// |(c << 4) * ir| < 2^27 and |ir0 * d| <= 2^30: no A1-A3 overflow
+		for (i = 0; i < 3; i++)
+			mac[i] = (((rgb[i] << 4) * ir[i]) + (gteIR0 * d[i])) >> 12;
+		gtePushColour(mac);
 	}
-	gteIR1 = limB1(gteMAC1, 1);
-	gteIR2 = limB2(gteMAC2, 1);
-	gteIR3 = limB3(gteMAC3, 1);
+	gteStoreMAC(mac);
+	gteLimB3(ir, mac, 1);
+	gteStoreIR(ir);
 }
 
 void gteOP() {
@@ -814,37 +962,31 @@ void gteNCS() {
 }
 
 void gteNCT() {
+	static const s32 zero[3] = { 0, 0, 0 };
+	gteMatrix llm, lcm;
+	s32 bk[3], mac[3], ir[3];
 	int v;
-	s32 vx, vy, vz;
 
 #ifdef GTE_LOG
 	GTE_LOG("GTE NCT\n");
 #endif
 	gteFLAG = 0;
 
+	gteLoadMatrix(&llm, 1);
+	gteLoadMatrix(&lcm, 2);
+	bk[0] = gteRBK;
+	bk[1] = gteGBK;
+	bk[2] = gteBBK;
+
 	for (v = 0; v < 3; v++) {
-		vx = VX(v);
-		vy = VY(v);
-		vz = VZ(v);
-		gteMAC1 = A1((((s64)gteL11 * vx) + (gteL12 * vy) + (gteL13 * vz)) >> 12);
-		gteMAC2 = A2((((s64)gteL21 * vx) + (gteL22 * vy) + (gteL23 * vz)) >> 12);
-		gteMAC3 = A3((((s64)gteL31 * vx) + (gteL32 * vy) + (gteL33 * vz)) >> 12);
-		gteIR1 = limB1(gteMAC1, 1);
-		gteIR2 = limB2(gteMAC2, 1);
-		gteIR3 = limB3(gteMAC3, 1);
-		gteMAC1 = A1((((s64)gteRBK << 12) + (gteLR1 * gteIR1) + (gteLR2 * gteIR2) + (gteLR3 * gteIR3)) >> 12);
-		gteMAC2 = A2((((s64)gteGBK << 12) + (gteLG1 * gteIR1) + (gteLG2 * gteIR2) + (gteLG3 * gteIR3)) >> 12);
-		gteMAC3 = A3((((s64)gteBBK << 12) + (gteLB1 * gteIR1) + (gteLB2 * gteIR2) + (gteLB3 * gteIR3)) >> 12);
-		gteRGB0 = gteRGB1;
-		gteRGB1 = gteRGB2;
-		gteCODE2 = gteCODE;
-		gteR2 = limC1(gteMAC1 >> 4);
-		gteG2 = limC2(gteMAC2 >> 4);
-		gteB2 = limC3(gteMAC3 >> 4);
+		gteTransform(mac, &llm, zero, VX(v), VY(v), VZ(v), 12);
+		gteLimB3(ir, mac, 1);
+		gteTransform(mac, &lcm, bk, ir[0], ir[1], ir[2], 12);
+		gtePushColour(mac);
 	}
-	gteIR1 = limB1(gteMAC1, 1);
-	gteIR2 = limB2(gteMAC2, 1);
-	gteIR3 = limB3(gteMAC3, 1);
+	gteStoreMAC(mac);
+	gteLimB3(ir, mac, 1);
+	gteStoreIR(ir);
 }
 
 void gteCC() {
@@ -26,6 +26,7 @@
 #include <sys/types.h>
 
 #include "../PsxCommon.h"
+#include "../PsxProf.h"
 #include "ppc.h"
 #include "reguse.h"
 #include "pR3000A.h"
@@ -610,9 +611,14 @@ static void Return()
 
 }
 
+/* guest cycles for a run of instructions at the configured CPU clock */
+static s32 iCycles(u32 insns) {
+	return (insns * psxCpuCycles + 8) >> 4;
+}
+
 static void iStoreCycle(s32 ahead) {
 	/* store cycle */
-    count = (((pc+ahead) - pcold)/4) <<1;
+    count = iCycles(((pc+ahead) - pcold)/4);
     ADDI(PutHWRegSpecial(CYCLECOUNT), GetHWRegSpecial(CYCLECOUNT), count + idlecyclecount);
 }
 
@@ -656,6 +662,16 @@ static s32 iLoadTest() {
 	return 0;
 }
 
+/* jump ahead to the next event when a taken branch closes an idle loop */
+static void iIdleSkip(u32 branchPC, u32 bpc) {
+	if (branchPC > bpc || !psxIdleLoop(bpc))
+		return;
+
+	LIW(PutHWRegSpecial(ARG1), bpc);
+	FlushAllHWReg();
+	CALLFunc((u32)psxIdleSkip);
+}
+
 /* set a pending branch */
 static void SetBranch() {
 	s32 treg;
@@ -692,7 +708,7 @@ static void SetBranch() {
 	iStoreCycle(0);
 	FlushAllHWReg();
 	CALLFunc((u32)psxBranchTest);
-	if(!Config.HLE && Config.PsxOut)
+	if(!Config.HLE && (Config.PsxOut || psxProf.enabled))
 		CALLFunc((u32)psxJumpTest);
 	
 	// TODO: don't return if target is compiled
@@ -730,8 +746,9 @@ static void iJump(u32 branchPC) {
 
 	iStoreCycle(0);
 	FlushAllHWReg();
+	iIdleSkip(branchPC, pc - 8);
 	CALLFunc((u32)psxBranchTest);
-	if(!Config.HLE && Config.PsxOut)
+	if(!Config.HLE && (Config.PsxOut || psxProf.enabled))
 		CALLFunc((u32)psxJumpTest);
 
 	// always return for now...
@@ -799,8 +816,9 @@ static void iBranch(u32 branchPC, s32 savectx) {
 
 	iStoreCycle(0);
 	FlushAllHWReg();
+	iIdleSkip(branchPC, pc - 8);
 	CALLFunc((u32)psxBranchTest);
-	if(!Config.HLE && Config.PsxOut)
+	if(!Config.HLE && (Config.PsxOut || psxProf.enabled))
 		CALLFunc((u32)psxJumpTest);
 	
 	// always return for now...
@@ -896,12 +914,66 @@ static void rec##f() { \
 	cop2readypc = pc + (psxCP2time[_fFunct_(psxCore.code)] << 2); \
 }
 
+/* Look ahead from the instruction after a GTE command: if another command
+ * or a CTC2 to FLAG comes before anything could read FLAG, its value is
+ * dead and the flag-free variant can be called instead. Gives up at
+ * branches, syscalls, COP0 and the end of the block, so a CFC2 always
+ * sees exact flags. */
+static int gteFlagDead(u32 addr) {
+	u32 code;
+	u8 *p;
+	s32 i;
+
+	if (branch) return 0;
+
+	for (i = 0; i < 32 && count + i < 500; i++, addr += 4) {
+		p = (u8 *)PSXM(addr);
+		if (p == NULL) return 0;
+		code = SWAP32(*(u32 *)p);
+
+		switch (code >> 26) {
+			case 0x00:
+				switch (code & 0x3f) {
+					case 0x08: case 0x09: case 0x0c: case 0x0d:
+						return 0;
+				}
+				break;
+			case 0x01: case 0x02: case 0x03: case 0x04:
+			case 0x05: case 0x06: case 0x07: case 0x10:
+				return 0;
+			case 0x12:
+				if (code & 0x02000000) return 1;
+				if (((code >> 11) & 0x1f) == 31) {
+					if (((code >> 21) & 0x1f) == 2) return 0;
+					if (((code >> 21) & 0x1f) == 6) return 1;
+				}
+				break;
+		}
+	}
+
+	return 0;
+}
+
+#define CP2_FUNCOP(f) \
+void gte##f(); \
+void gte##f##_nf(); \
+static void rec##f() { \
+	if (pc < cop2readypc) idlecyclecount += ((cop2readypc - pc)>>2); \
+	iFlushRegs(0); \
+	LIW(0, (u32)psxCore.code); \
+	STW(0, OFFSET(&psxCore, &psxCore.code), GetHWRegSpecial(PSXCORE)); \
+	FlushAllHWReg(); \
+	CALLFunc (gteFlagDead(pc) ? (u32)gte##f##_nf : (u32)gte##f); \
+	cop2readypc = pc + (psxCP2time[_fFunct_(psxCore.code)] << 2); \
+}
+
 #define CP2_FUNCNC(f) \
 void gte##f(); \
+void gte##f##_nf(); \
 static void rec##f() { \
 	if (pc < cop2readypc) idlecyclecount += ((cop2readypc - pc)>>2); \
 	iFlushRegs(0); \
-	CALLFunc ((u32)gte##f); \
+	CALLFunc (gteFlagDead(pc) ? (u32)gte##f##_nf : (u32)gte##f); \
 	cop2readypc = pc + (psxCP2time[_fFunct_(psxCore.code)] << 2); \
 }
 
@@ -2449,11 +2521,11 @@ CP2_FUNC(LWC2);
 CP2_FUNC(SWC2);
 
 CP2_FUNCNC(RTPS);
-CP2_FUNC(OP);
+CP2_FUNCOP(OP);
 CP2_FUNCNC(NCLIP);
 CP2_FUNCNC(DPCS);
 CP2_FUNCNC(INTPL);
-CP2_FUNC(MVMVA);
+CP2_FUNCOP(MVMVA);
 CP2_FUNCNC(NCDS);
 CP2_FUNCNC(NCDT);
 CP2_FUNCNC(CDP);
@@ -2461,14 +2533,14 @@ CP2_FUNCNC(NCCS);
 CP2_FUNCNC(CC);
 CP2_FUNCNC(NCS);
 CP2_FUNCNC(NCT);
-CP2_FUNC(SQR);
+CP2_FUNCOP(SQR);
 CP2_FUNCNC(DCPL);
 CP2_FUNCNC(DPCT);
 CP2_FUNCNC(AVSZ3);
 CP2_FUNCNC(AVSZ4);
 CP2_FUNCNC(RTPT);
-CP2_FUNC(GPF);
-CP2_FUNC(GPL);
+CP2_FUNCOP(GPF);
+CP2_FUNCOP(GPL);
 CP2_FUNCNC(NCCT);
 
 static void recHLE() {
@@ -2482,7 +2554,7 @@ static void recHLE() {
 		CALLFunc((u32)psxHLEt[0]); // call dummy function
 	}
 	
-	count = ((((pc - pcold)/4) + 20)) <<1;
+	count = iCycles(((pc - pcold)/4) + 20);
 	ADDI(PutHWRegSpecial(CYCLECOUNT), GetHWRegSpecial(CYCLECOUNT), count + idlecyclecount);
 	FlushAllHWReg();
 	CALLFunc((u32)psxBranchTest);
@@ -23,6 +23,7 @@
 #include "psxcommon.h"
 #include "ppf.h"
 #include "cdrom.h"
+#include "cdriso.h"
 
 typedef struct tagPPF_DATA {
 	s32					addr;
@@ -31,48 +32,114 @@ typedef struct tagPPF_DATA {
 	struct tagPPF_DATA	*pNext;
 } PPF_DATA;
 
-typedef struct tagPPF_CACHE {
-	s32					addr;
-	struct tagPPF_DATA	*pNext;
-} PPF_CACHE;
+// Sector overlay: one slot per sector that has PPF patches or an SBI entry,
+// open addressed by sector number so a read finds its record in O(1)
+typedef struct {
+	s32					addr;		// -1 for a free slot
+	struct tagPPF_DATA	*pNext;		// first patch of the sector, NULL if none
+	boolean				sbi;
+} PPF_SECTOR;
 
-static PPF_CACHE		*ppfCache = NULL;
 static PPF_DATA			*ppfHead = NULL, *ppfLast = NULL;
-static int				iPPFNum = 0;
+static PPF_SECTOR		*ppfSectors = NULL;
+static u32				ppfMask = 0;
 
-// using a linked data list, and address array
-static void FillPPFCache() {
-	PPF_DATA		*p;
-	PPF_CACHE		*pc;
-	s32				lastaddr;
+// redump.org SBI sectors, kept so the overlay can be rebuilt with them
+static s32				*sbiSectors = NULL;
+static int				sbicount = 0;
 
-	p = ppfHead;
-	lastaddr = -1;
-	iPPFNum = 0;
+static PPF_SECTOR *FindSector(s32 addr) {
+	u32 h;
 
-	while (p != NULL) {
-		if (p->addr != lastaddr) iPPFNum++;
-		lastaddr = p->addr;
+	if (ppfSectors == NULL || addr < 0) return NULL;
+
+	for (h = (u32)addr * 2654435761u; ; h++) {
+		PPF_SECTOR *ps = &ppfSectors[h & ppfMask];
+
+		if (ps->addr == addr) return ps;
+		if (ps->addr == -1) return NULL;
+	}
+}
+
+static PPF_SECTOR *AddSector(s32 addr) {
+	u32 h;
+
+	for (h = (u32)addr * 2654435761u; ; h++) {
+		PPF_SECTOR *ps = &ppfSectors[h & ppfMask];
+
+		if (ps->addr == addr) return ps;
+		if (ps->addr == -1) {
+			ps->addr = addr;
+			ps->pNext = NULL;
+			ps->sbi = FALSE;
+			return ps;
+		}
+	}
+}
+
+static void PatchSector(unsigned char *pB, PPF_DATA *p) {
+	s32 addr = p->addr, pos, anz, start;
+
+	while (p != NULL && p->addr == addr) {
+		pos = p->pos - (CD_FRAMESIZE_RAW - DATA_SIZE);
+		anz = p->anz;
+		if (pos < 0) { start = -pos; pos = 0; anz -= start; }
+		else start = 0;
+		memcpy(pB + pos, (unsigned char *)(p + 1) + start, anz);
 		p = p->pNext;
 	}
+}
 
-	if (iPPFNum <= 0) return;
+// Lays every patch into the ISO backend's mapped image, so sectors read
+// from it come out already patched. Only called while building the table
+// for the disc that is open, as the patches can't be taken out again.
+static void ApplyPPFImage() {
+	u32 i;
 
-	pc = ppfCache = (PPF_CACHE *)malloc(iPPFNum * sizeof(PPF_CACHE));
+	if (ppfSectors == NULL) return;
 
-	iPPFNum--;
-	p = ppfHead;
-	lastaddr = -1;
+	for (i = 0; i <= ppfMask; i++) {
+		PPF_SECTOR *ps = &ppfSectors[i];
+		unsigned char *pB;
 
-	while (p != NULL) {
-		if (p->addr != lastaddr) {
-			pc->addr = p->addr;
-			pc->pNext = p;
-			pc++;
-		}
+		if (ps->addr == -1 || ps->pNext == NULL) continue;
+		pB = cdrIsoMappedSector(ps->addr);
+		if (pB != NULL) PatchSector(pB + 12, ps->pNext);
+	}
+}
+
+// (Re)builds the overlay from the patch list, which is sorted by sector,
+// and the SBI sectors
+static void BuildOverlay() {
+	PPF_DATA	*p;
+	s32			lastaddr = -1;
+	u32			n = sbicount, size = 16, i;
+
+	if (ppfSectors != NULL) free(ppfSectors);
+	ppfSectors = NULL;
+
+	for (p = ppfHead; p != NULL; p = p->pNext) {
+		if (p->addr != lastaddr) n++;
 		lastaddr = p->addr;
-		p = p->pNext;
 	}
+	if (n == 0) return;
+
+	// keep the table at most half full
+	while (size < n * 2) size <<= 1;
+	ppfSectors = (PPF_SECTOR *)malloc(size * sizeof(PPF_SECTOR));
+	if (ppfSectors == NULL) return;
+	ppfMask = size - 1;
+	for (i = 0; i < size; i++) ppfSectors[i].addr = -1;
+
+	lastaddr = -1;
+	for (p = ppfHead; p != NULL; p = p->pNext) {
+		if (p->addr != lastaddr) AddSector(p->addr)->pNext = p;
+		lastaddr = p->addr;
+	}
+	for (i = 0; i < (u32)sbicount; i++)
+		AddSector(sbiSectors[i])->sbi = TRUE;
+
+	ApplyPPFImage();
 }
 
 void FreePPFCache() {
@@ -87,48 +154,23 @@ void FreePPFCache() {
 	ppfHead = NULL;
 	ppfLast = NULL;
 
-	if (ppfCache != NULL) free(ppfCache);
-	ppfCache = NULL;
+	BuildOverlay();
 }
 
-void CheckPPFCache(unsigned char *pB, unsigned char m, unsigned char s, unsigned char f) {
-	PPF_CACHE *pcstart, *pcend, *pcpos;
-	int addr = MSF2SECT(btoi(m), btoi(s), btoi(f)), pos, anz, start;
+// Patches a sector the ISO backend just read into pB (its data past the
+// 12 byte sync)
+void ApplyPPFSector(unsigned char *pB, s32 addr) {
+	PPF_SECTOR *ps = FindSector(addr);
 
-	if (ppfCache == NULL) return;
-
-	pcstart = ppfCache;
-	if (addr < pcstart->addr) return;
-	pcend = ppfCache + iPPFNum;
-	if (addr > pcend->addr) return;
-
-	while (1) {
-		if (addr == pcend->addr) { pcpos = pcend; break; }
+	if (ps != NULL && ps->pNext != NULL) PatchSector(pB, ps->pNext);
+}
 
-		pcpos = pcstart + (pcend - pcstart) / 2;
-		if (pcpos == pcstart) break;
-		if (addr < pcpos->addr) {
-			pcend = pcpos;
-			continue;
-		}
-		if (addr > pcpos->addr) {
-			pcstart = pcpos;
-			continue;
-		}
-		break;
-	}
+// For the plugin backends. The ISO backend lays the overlay itself while
+// it fills the sector.
+void CheckPPFCache(unsigned char *pB, unsigned char m, unsigned char s, unsigned char f) {
+	if (ppfSectors == NULL || cdrIsoActive()) return;
 
-	if (addr == pcpos->addr) {
-		PPF_DATA *p = pcpos->pNext;
-		while (p != NULL && p->addr == addr) {
-			pos = p->pos - (CD_FRAMESIZE_RAW - DATA_SIZE);
-			anz = p->anz;
-			if (pos < 0) { start = -pos; pos = 0; anz -= start; }
-			else start = 0;
-			memcpy(pB + pos, (unsigned char *)(p + 1) + start, anz);
-			p = p->pNext;
-		}
-	}
+	ApplyPPFSector(pB, MSF2SECT(btoi(m), btoi(s), btoi(f)));
 }
 
 static void AddToPPF(s32 ladr, s32 pos, s32 anz, unsigned char *ppfmem) {
@@ -139,7 +181,6 @@ static void AddToPPF(s32 ladr, s32 pos, s32 anz, unsigned char *ppfmem) {
 		ppfHead->pos = pos;
 		ppfHead->anz = anz;
 		memcpy(ppfHead + 1, ppfmem, anz);
-		iPPFNum = 1;
 		ppfLast = ppfHead;
 	} else {
 		PPF_DATA *p = ppfHead;
@@ -170,7 +211,6 @@ static void AddToPPF(s32 ladr, s32 pos, s32 anz, unsigned char *ppfmem) {
 		padd->pos = pos;
 		padd->anz = anz;
 		memcpy(padd + 1, ppfmem, anz);
-		iPPFNum++;
 		if (plast == NULL) ppfHead = padd;
 		else plast->pNext = padd;
 
@@ -329,17 +369,23 @@ void BuildPPFCache() {
 
 	fclose(ppffile);
 
-	FillPPFCache(); // build address array
+	BuildOverlay();
 
 	SysPrintf(_("Loaded PPF %d.0 patch: %s.\n"), method + 1, szPPF);
 }
 
 // redump.org SBI files
-static u8 sbitime[256][3], sbicount;
-
 void LoadSBI() {
 	FILE *sbihandle;
 	char buffer[16], sbifile[MAXPATHLEN];
+	u8 sbitime[3], type;
+	int size = 0;
+
+	// init
+	if (sbiSectors != NULL) free(sbiSectors);
+	sbiSectors = NULL;
+	sbicount = 0;
+	BuildOverlay();
 
     if (CdromId[0] == '\0') return;
 
@@ -363,34 +409,36 @@ void LoadSBI() {
 
 	sprintf(sbifile, "%s%s", Config.PatchesDir, buffer);
 
-	// init
-	sbicount = 0;
-
 	sbihandle = fopen(sbifile, "rb");
 	if (sbihandle == NULL) return;
 
 	// 4-byte SBI header
 	fread(buffer, 1, 4, sbihandle);
-	while (!feof(sbihandle)) {
-		fread(sbitime[sbicount++], 1, 3, sbihandle);
-		fread(buffer, 1, 11, sbihandle);
+	while (fread(sbitime, 1, 3, sbihandle) == 3 && fread(&type, 1, 1, sbihandle) == 1) {
+		// type 1 carries the whole Q channel, 2 and 3 only a time. GetlocP
+		// wipes the position on these sectors, so only the time is kept.
+		fseek(sbihandle, type == 1 ? 10 : 3, SEEK_CUR);
+
+		if (sbicount == size) {
+			s32 *grown = (s32 *)realloc(sbiSectors, (size + 256) * sizeof(s32));
+			if (grown == NULL) break;
+			sbiSectors = grown;
+			size += 256;
+		}
+		sbiSectors[sbicount++] = MSF2SECT(btoi(sbitime[0]), btoi(sbitime[1]), btoi(sbitime[2]));
 	}
 
 	fclose(sbihandle);
 
+	BuildOverlay();
+
 	SysPrintf(_("Loaded SBI file: %s.\n"), sbifile);
 }
 
 boolean CheckSBI(const u8 *time) {
-	int lcv;
-
-	// both BCD format
-	for (lcv = 0; lcv < sbicount; lcv++) {
-		if (time[0] == sbitime[lcv][0] && 
-				time[1] == sbitime[lcv][1] && 
-				time[2] == sbitime[lcv][2])
-			return TRUE;
-	}
+	PPF_SECTOR *ps;
 
-	return FALSE;
+	// BCD format
+	ps = FindSector(MSF2SECT(btoi(time[0]), btoi(time[1]), btoi(time[2])));
+	return ps != NULL && ps->sbi;
 }